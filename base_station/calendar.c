@@ -0,0 +1,38 @@
+/*
+ * Calendar clock
+ *
+ * Created: 17-10-2026 00:52:09
+ *
+ * Keeps the local broken-down time of the last requested system time, so
+ * the clock that is drawn every second only needs a few increments. A full
+ * conversion by localtime_r() is done on the first call, when time went
+ * back or jumped, and at every quarter hour, which covers day rollover and
+ * the daylight saving time transitions of the built in time zones.
+ */ 
+
+#include <stdbool.h>
+#include "calendar.h"
+
+static time_t calendar_time;	// system time of calendar_tm
+static struct tm calendar_tm;
+static bool valid;
+
+// returns local time of now, advanced from the previous call within the quarter hour
+const struct tm *calendar_local(time_t now) {
+	if (valid && now >= calendar_time && now - calendar_time < 60) {
+		calendar_tm.tm_sec += now - calendar_time;
+		calendar_time = now;
+		if (calendar_tm.tm_sec < 60) return &calendar_tm;
+		calendar_tm.tm_sec -= 60;
+		if (++calendar_tm.tm_min % 15) return &calendar_tm;
+	}
+	localtime_r(&now, &calendar_tm);
+	calendar_time = now;
+	valid = true;
+	return &calendar_tm;
+}
+
+// force full conversion after time zone or daylight saving time changed
+void calendar_reset(void) {
+	valid = false;
+}
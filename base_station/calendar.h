@@ -0,0 +1,16 @@
+/*
+ * Calendar clock
+ *
+ * Created: 17-10-2026 00:52:09
+ */ 
+
+
+#ifndef CALENDAR_H_
+#define CALENDAR_H_
+
+#include <time.h>
+
+const struct tm *calendar_local(time_t now);
+void calendar_reset(void);
+
+#endif /* CALENDAR_H_ */
@@ -0,0 +1,107 @@
+/*
+ * Glyph offset tables for proportional fonts
+ * Generated by tools/fontindex.c, do not edit
+ *
+ * Every entry is the big endian offset of the character data from the
+ * start of the font. Pass it to ili9341_setFontIndex() with the font.
+ */
+
+#ifndef _fontIndex_h_
+#define _fontIndex_h_
+
+GLCDFONTDECL(Iain5x7_index) = {
+	0x00, 0x66, 0x00, 0x67, 0x00, 0x68, 0x00, 0x6B, 0x00, 0x70, 0x00, 0x75, 0x00, 0x7A, 0x00, 0x7F,
+	0x00, 0x80, 0x00, 0x82, 0x00, 0x84, 0x00, 0x89, 0x00, 0x8C, 0x00, 0x8D, 0x00, 0x8F, 0x00, 0x90,
+	0x00, 0x93, 0x00, 0x97, 0x00, 0x99, 0x00, 0x9D, 0x00, 0xA1, 0x00, 0xA5, 0x00, 0xA9, 0x00, 0xAD,
+	0x00, 0xB1, 0x00, 0xB5, 0x00, 0xB9, 0x00, 0xBA, 0x00, 0xBB, 0x00, 0xBE, 0x00, 0xC1, 0x00, 0xC4,
+	0x00, 0xC8, 0x00, 0xCD, 0x00, 0xD1, 0x00, 0xD5, 0x00, 0xD9, 0x00, 0xDD, 0x00, 0xE1, 0x00, 0xE5,
+	0x00, 0xE9, 0x00, 0xED, 0x00, 0xF0, 0x00, 0xF4, 0x00, 0xF9, 0x00, 0xFC, 0x01, 0x01, 0x01, 0x06,
+	0x01, 0x0B, 0x01, 0x0F, 0x01, 0x14, 0x01, 0x18, 0x01, 0x1C, 0x01, 0x1F, 0x01, 0x23, 0x01, 0x28,
+	0x01, 0x2D, 0x01, 0x32, 0x01, 0x37, 0x01, 0x3C, 0x01, 0x3E, 0x01, 0x41, 0x01, 0x43, 0x01, 0x46,
+	0x01, 0x49, 0x01, 0x4A, 0x01, 0x4E, 0x01, 0x52, 0x01, 0x56, 0x01, 0x5A, 0x01, 0x5E, 0x01, 0x62,
+	0x01, 0x66, 0x01, 0x6A, 0x01, 0x6B, 0x01, 0x6E, 0x01, 0x72, 0x01, 0x73, 0x01, 0x78, 0x01, 0x7C,
+	0x01, 0x80, 0x01, 0x84, 0x01, 0x88, 0x01, 0x8C, 0x01, 0x90, 0x01, 0x94, 0x01, 0x98, 0x01, 0x9B,
+	0x01, 0xA0, 0x01, 0xA3, 0x01, 0xA7, 0x01, 0xAB, 0x01, 0xAE, 0x01, 0xAF, 0x01, 0xB2, 0x01, 0xB7,
+};
+
+GLCDFONTDECL(Arial14_index) = {
+	0x00, 0x66, 0x00, 0x66, 0x00, 0x68, 0x00, 0x6E, 0x00, 0x7E, 0x00, 0x8C, 0x00, 0xA0, 0x00, 0xB0,
+	0x00, 0xB2, 0x00, 0xB8, 0x00, 0xBE, 0x00, 0xC8, 0x00, 0xD6, 0x00, 0xD8, 0x00, 0xE0, 0x00, 0xE2,
+	0x00, 0xEA, 0x00, 0xF6, 0x00, 0xFC, 0x01, 0x08, 0x01, 0x14, 0x01, 0x22, 0x01, 0x2E, 0x01, 0x3A,
+	0x01, 0x46, 0x01, 0x52, 0x01, 0x5E, 0x01, 0x60, 0x01, 0x62, 0x01, 0x6E, 0x01, 0x7A, 0x01, 0x86,
+	0x01, 0x92, 0x01, 0xAC, 0x01, 0xBE, 0x01, 0xCC, 0x01, 0xDC, 0x01, 0xEC, 0x01, 0xFA, 0x02, 0x08,
+	0x02, 0x1A, 0x02, 0x28, 0x02, 0x2A, 0x02, 0x34, 0x02, 0x44, 0x02, 0x52, 0x02, 0x64, 0x02, 0x72,
+	0x02, 0x84, 0x02, 0x92, 0x02, 0xA4, 0x02, 0xB4, 0x02, 0xC2, 0x02, 0xD0, 0x02, 0xDE, 0x02, 0xF0,
+	0x03, 0x0A, 0x03, 0x1A, 0x03, 0x2C, 0x03, 0x3C, 0x03, 0x40, 0x03, 0x48, 0x03, 0x4C, 0x03, 0x56,
+	0x03, 0x66, 0x03, 0x6A, 0x03, 0x76, 0x03, 0x82, 0x03, 0x8C, 0x03, 0x98, 0x03, 0xA4, 0x03, 0xAC,
+	0x03, 0xB8, 0x03, 0xC4, 0x03, 0xC6, 0x03, 0xCA, 0x03, 0xD6, 0x03, 0xD8, 0x03, 0xEA, 0x03, 0xF6,
+	0x04, 0x02, 0x04, 0x0E, 0x04, 0x1A, 0x04, 0x22, 0x04, 0x2C, 0x04, 0x34, 0x04, 0x40, 0x04, 0x4E,
+	0x04, 0x60, 0x04, 0x6C, 0x04, 0x7A, 0x04, 0x86, 0x04, 0x8C, 0x04, 0x8E, 0x04, 0x94, 0x04, 0xA2,
+};
+
+GLCDFONTDECL(Arial_bold_14_index) = {
+	0x00, 0x66, 0x00, 0x6E, 0x00, 0x72, 0x00, 0x7C, 0x00, 0x88, 0x00, 0x96, 0x00, 0xA6, 0x00, 0xB8,
+	0x00, 0xBC, 0x00, 0xC2, 0x00, 0xC8, 0x00, 0xD2, 0x00, 0xE2, 0x00, 0xE6, 0x00, 0xEE, 0x00, 0xF2,
+	0x00, 0xFA, 0x01, 0x08, 0x01, 0x10, 0x01, 0x1E, 0x01, 0x2C, 0x01, 0x3A, 0x01, 0x48, 0x01, 0x56,
+	0x01, 0x64, 0x01, 0x72, 0x01, 0x80, 0x01, 0x84, 0x01, 0x88, 0x01, 0x96, 0x01, 0xA4, 0x01, 0xB2,
+	0x01, 0xC2, 0x01, 0xDE, 0x01, 0xF0, 0x02, 0x00, 0x02, 0x10, 0x02, 0x20, 0x02, 0x2E, 0x02, 0x3C,
+	0x02, 0x4E, 0x02, 0x5E, 0x02, 0x62, 0x02, 0x70, 0x02, 0x80, 0x02, 0x8E, 0x02, 0xA4, 0x02, 0xB4,
+	0x02, 0xC6, 0x02, 0xD4, 0x02, 0xE6, 0x02, 0xF8, 0x03, 0x06, 0x03, 0x16, 0x03, 0x26, 0x03, 0x38,
+	0x03, 0x52, 0x03, 0x60, 0x03, 0x70, 0x03, 0x80, 0x03, 0x88, 0x03, 0x90, 0x03, 0x98, 0x03, 0xA4,
+	0x03, 0xB4, 0x03, 0xBA, 0x03, 0xC8, 0x03, 0xD6, 0x03, 0xE2, 0x03, 0xF0, 0x03, 0xFE, 0x04, 0x08,
+	0x04, 0x16, 0x04, 0x24, 0x04, 0x28, 0x04, 0x2E, 0x04, 0x3A, 0x04, 0x3E, 0x04, 0x52, 0x04, 0x60,
+	0x04, 0x6E, 0x04, 0x7C, 0x04, 0x8A, 0x04, 0x94, 0x04, 0xA0, 0x04, 0xAA, 0x04, 0xB8, 0x04, 0xC6,
+	0x04, 0xDC, 0x04, 0xE8, 0x04, 0xF6, 0x05, 0x00, 0x05, 0x0A, 0x05, 0x0C, 0x05, 0x16, 0x05, 0x24,
+};
+
+GLCDFONTDECL(Corsiva_12_index) = {
+	0x00, 0x66, 0x00, 0x6C, 0x00, 0x70, 0x00, 0x74, 0x00, 0x80, 0x00, 0x8A, 0x00, 0x98, 0x00, 0xAA,
+	0x00, 0xAC, 0x00, 0xB2, 0x00, 0xBA, 0x00, 0xBE, 0x00, 0xC8, 0x00, 0xCC, 0x00, 0xD2, 0x00, 0xD4,
+	0x00, 0xDE, 0x00, 0xE8, 0x00, 0xF0, 0x00, 0xFA, 0x01, 0x02, 0x01, 0x0C, 0x01, 0x18, 0x01, 0x22,
+	0x01, 0x2C, 0x01, 0x36, 0x01, 0x40, 0x01, 0x44, 0x01, 0x4A, 0x01, 0x54, 0x01, 0x5E, 0x01, 0x68,
+	0x01, 0x70, 0x01, 0x7E, 0x01, 0x8C, 0x01, 0x9A, 0x01, 0xA6, 0x01, 0xB6, 0x01, 0xC4, 0x01, 0xD2,
+	0x01, 0xE0, 0x01, 0xF4, 0x01, 0xFE, 0x02, 0x0A, 0x02, 0x1C, 0x02, 0x2A, 0x02, 0x3C, 0x02, 0x50,
+	0x02, 0x5C, 0x02, 0x6A, 0x02, 0x7C, 0x02, 0x8E, 0x02, 0x9A, 0x02, 0xAA, 0x02, 0xBA, 0x02, 0xCA,
+	0x02, 0xE0, 0x02, 0xF2, 0x03, 0x04, 0x03, 0x12, 0x03, 0x18, 0x03, 0x1E, 0x03, 0x26, 0x03, 0x2C,
+	0x03, 0x38, 0x03, 0x3C, 0x03, 0x44, 0x03, 0x4C, 0x03, 0x54, 0x03, 0x60, 0x03, 0x68, 0x03, 0x74,
+	0x03, 0x80, 0x03, 0x88, 0x03, 0x8E, 0x03, 0x96, 0x03, 0xA2, 0x03, 0xA8, 0x03, 0xB4, 0x03, 0xBC,
+	0x03, 0xC4, 0x03, 0xCE, 0x03, 0xD8, 0x03, 0xE0, 0x03, 0xE8, 0x03, 0xF0, 0x03, 0xF8, 0x04, 0x04,
+	0x04, 0x14, 0x04, 0x22, 0x04, 0x2C, 0x04, 0x38, 0x04, 0x3E, 0x04, 0x40, 0x04, 0x48, 0x04, 0x52,
+};
+
+GLCDFONTDECL(Verdana_digits_24_index) = {
+	0x00, 0x11, 0x00, 0x41, 0x00, 0x68, 0x00, 0x95, 0x00, 0xC2, 0x00, 0xF5, 0x01, 0x22, 0x01, 0x52,
+	0x01, 0x82, 0x01, 0xB2, 0x01, 0xE2,
+};
+
+GLCDFONTDECL(CalBlk36_index) = {
+	0x00, 0x66, 0x00, 0x66, 0x00, 0x8E, 0x00, 0xDE, 0x01, 0x4C, 0x01, 0xBA, 0x02, 0x5A, 0x02, 0xE1,
+	0x03, 0x09, 0x03, 0x3B, 0x03, 0x6D, 0x03, 0xB3, 0x04, 0x12, 0x04, 0x3A, 0x04, 0x6C, 0x04, 0x94,
+	0x04, 0xC6, 0x05, 0x2F, 0x05, 0x7A, 0x05, 0xE3, 0x06, 0x47, 0x06, 0xB5, 0x07, 0x1E, 0x07, 0x87,
+	0x07, 0xEB, 0x08, 0x4F, 0x08, 0xB8, 0x08, 0xE0, 0x09, 0x08, 0x09, 0x6C, 0x09, 0xCB, 0x0A, 0x2F,
+	0x0A, 0x93, 0x0B, 0x1A, 0x0B, 0xA6, 0x0C, 0x19, 0x0C, 0x91, 0x0D, 0x04, 0x0D, 0x6D, 0x0D, 0xCC,
+	0x0E, 0x4E, 0x0E, 0xC6, 0x0E, 0xEE, 0x0F, 0x52, 0x0F, 0xD9, 0x10, 0x3D, 0x10, 0xCE, 0x11, 0x46,
+	0x11, 0xC8, 0x12, 0x31, 0x12, 0xB8, 0x13, 0x35, 0x13, 0xA8, 0x14, 0x20, 0x14, 0x98, 0x15, 0x24,
+	0x15, 0xD8, 0x16, 0x64, 0x16, 0xF0, 0x17, 0x68, 0x17, 0x9F, 0x17, 0xD1, 0x18, 0x08, 0x18, 0x67,
+	0x18, 0xC1, 0x18, 0xE9, 0x19, 0x57, 0x19, 0xC0, 0x1A, 0x29, 0x1A, 0x92, 0x1B, 0x00, 0x1B, 0x46,
+	0x1B, 0xAF, 0x1C, 0x13, 0x1C, 0x3B, 0x1C, 0x6D, 0x1C, 0xDB, 0x1D, 0x03, 0x1D, 0xA3, 0x1E, 0x07,
+	0x1E, 0x75, 0x1E, 0xDE, 0x1F, 0x47, 0x1F, 0x8D, 0x1F, 0xF1, 0x20, 0x37, 0x20, 0x9B, 0x21, 0x09,
+	0x21, 0xB3, 0x22, 0x21, 0x22, 0x8F, 0x22, 0xE9, 0x23, 0x2F, 0x23, 0x43, 0x23, 0x89, 0x23, 0xED,
+};
+
+GLCDFONTDECL(CalLite24_index) = {
+	0x00, 0x66, 0x00, 0x82, 0x00, 0x8E, 0x00, 0xAA, 0x00, 0xE6, 0x01, 0x16, 0x01, 0x6E, 0x01, 0xAE,
+	0x01, 0xB6, 0x01, 0xD2, 0x01, 0xEE, 0x02, 0x1A, 0x02, 0x56, 0x02, 0x66, 0x02, 0x82, 0x02, 0x8E,
+	0x02, 0xB6, 0x02, 0xE6, 0x03, 0x0E, 0x03, 0x3E, 0x03, 0x6A, 0x03, 0x9E, 0x03, 0xCE, 0x03, 0xFE,
+	0x04, 0x2E, 0x04, 0x5E, 0x04, 0x92, 0x04, 0x9E, 0x04, 0xAE, 0x04, 0xE2, 0x05, 0x1A, 0x05, 0x52,
+	0x05, 0x7A, 0x05, 0xCA, 0x06, 0x0A, 0x06, 0x3E, 0x06, 0x7A, 0x06, 0xB6, 0x06, 0xE6, 0x07, 0x12,
+	0x07, 0x52, 0x07, 0x8A, 0x07, 0xA2, 0x07, 0xC2, 0x07, 0xFA, 0x08, 0x26, 0x08, 0x66, 0x08, 0x9E,
+	0x08, 0xE2, 0x09, 0x12, 0x09, 0x56, 0x09, 0x8E, 0x09, 0xC2, 0x09, 0xFE, 0x0A, 0x32, 0x0A, 0x6E,
+	0x0A, 0xC2, 0x0A, 0xFA, 0x0B, 0x2E, 0x0B, 0x66, 0x0B, 0x7E, 0x0B, 0xA6, 0x0B, 0xBE, 0x0B, 0xF6,
+	0x0C, 0x32, 0x0C, 0x42, 0x0C, 0x6E, 0x0C, 0x9E, 0x0C, 0xCA, 0x0C, 0xFA, 0x0D, 0x2A, 0x0D, 0x46,
+	0x0D, 0x76, 0x0D, 0xA2, 0x0D, 0xAE, 0x0D, 0xC6, 0x0D, 0xF6, 0x0D, 0xFE, 0x0E, 0x4A, 0x0E, 0x76,
+	0x0E, 0xA6, 0x0E, 0xD6, 0x0F, 0x06, 0x0F, 0x26, 0x0F, 0x4E, 0x0F, 0x6E, 0x0F, 0x9A, 0x0F, 0xCA,
+	0x10, 0x0E, 0x10, 0x3E, 0x10, 0x6E, 0x10, 0x9A, 0x10, 0xC6, 0x10, 0xCE, 0x10, 0xFA, 0x11, 0x36,
+};
+
+#endif
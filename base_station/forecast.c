@@ -0,0 +1,109 @@
+/*
+ * Weather forecast
+ *
+ * Created: 16-10-2026 23:02:51
+ *
+ * Pressure trend and Zambretti forecaster, kept free of hardware access so
+ * it also builds on the host, see tools/forecastreplay.c.
+ */ 
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const char *)(addr))
+#endif
+#include "forecast.h"
+
+#define COV_MAX (INT32_MAX / (12 * 60 / FORECAST_INTERVAL))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+static const char rising[] PROGMEM = {
+	'A', 'B', 'B', 'C', 'F', 'G', 'I', 'J', 'L', 'M', 'M', 'Q', 'T', 'Y'
+};
+static const char falling[] PROGMEM = {
+	'B', 'D', 'H', 'O', 'R', 'U', 'V', 'X', 'X', 'Z'
+};
+static const char steady[] PROGMEM = {
+	'A', 'B', 'B', 'B', 'E', 'K', 'N', 'N', 'P', 'P', 'S', 'W', 'W', 'X', 'X', 'X', 'Z'
+};
+
+int32_t forecast_trend;
+
+static int16_t samples[FORECAST_SAMPLES];
+static uint8_t head, count, minuteCount;
+static uint32_t reference;
+static int32_t pressureSum, sumP, sumTP;
+
+void forecast_init(void) {
+	forecast_trend = 0;
+	head = count = minuteCount = 0;
+	reference = 0;
+	pressureSum = sumP = sumTP = 0;
+}
+
+// Based on https://www.nxp.com/docs/en/application-note/AN3914.pdf
+// Pressure in Pa, once per minute -->  forecast done by calculating Pa/h
+// The slope is fitted by least squares over a sliding window of averaged
+// samples, t is the sample number in the window with the oldest at 0
+void forecast_sample(uint32_t pressure) {
+	// samples are stored relative to the first pressure
+	if (!reference) reference = pressure;
+	pressureSum += (int32_t)(pressure - reference);
+	if (++minuteCount < FORECAST_INTERVAL) return;
+	int16_t p = constrain(pressureSum / FORECAST_INTERVAL, INT16_MIN, INT16_MAX);
+	pressureSum = 0;
+	minuteCount = 0;
+	if (count == FORECAST_SAMPLES) {
+		// drop oldest sample, the others move one step back in time
+		sumP -= samples[head];
+		sumTP -= sumP;
+		count--;
+	}
+	samples[head] = p;
+	head = (head + 1) % FORECAST_SAMPLES;
+	sumTP += (int32_t)count * p;
+	sumP += p;
+	count++;
+	if (count < FORECAST_MIN_SAMPLES) return;
+	// sum of t and sum of squared deviations of t only depend on count
+	int32_t sumT = count * (count - 1) / 2;
+	int32_t n3 = (int32_t)count * (count * count - 1);
+	// covariance sum, limited to prevent overflow when scaled
+	int32_t cov = constrain((count * sumTP - sumT * sumP) / count, -COV_MAX, COV_MAX);
+	// slope = 12 * cov / n3 in Pa per sample
+	forecast_trend = cov * (12 * 60 / FORECAST_INTERVAL) / n3;
+}
+
+// Simple implementation of Zambretti forecaster algorithm
+// Sea level pressure in Pa and month 0-11, returns forecast letter A-Z
+char forecast_zambretti(int32_t pressure, int8_t month, bool north) {
+	if (forecast_trend > FORECAST_THRESHOLD) {
+		// rising pressure
+		if (north == (month >= 4 && month <= 9)) pressure += 320;
+		int8_t index = (103140 - pressure) / 574;
+		if (index < 0) index = 0;
+		if (index > 13) index = 13;
+		return pgm_read_byte(&rising[index]);
+	} else if (forecast_trend < -FORECAST_THRESHOLD) {
+		// falling pressure
+		if (north == (month >= 4 && month <= 9)) pressure -= 320;
+		int8_t index = (102995 - pressure) / 652;
+		if (index < 0) index = 0;
+		if (index > 9) index = 9;
+		return pgm_read_byte(&falling[index]);
+	} else {
+		// steady
+		int8_t index = (103081 - pressure) / 432;
+		if (index < 0) index = 0;
+		if (index > 16) index = 16;
+		return pgm_read_byte(&steady[index]);
+	}
+}
+
+// convert station pressure to sea level pressure
+// Babinet's formula is accurate up to 1000 meters and within 1% to considerably greater heights.
+int32_t forecast_seaLevel(int32_t pressure, int8_t temperature, int16_t altitude) {
+	// altitude in whole meters and temperature in whole degrees (not scaled)
+	return -pressure * (altitude + 16000 + 64 * temperature) / (altitude - 16000 - 64 * temperature);
+}
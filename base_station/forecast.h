@@ -0,0 +1,26 @@
+/*
+ * Weather forecast
+ *
+ * Created: 16-10-2026 23:02:51
+ */ 
+
+
+#ifndef FORECAST_H_
+#define FORECAST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FORECAST_INTERVAL 5		// minutes averaged per sample
+#define FORECAST_SAMPLES 36		// window of 3 hours
+#define FORECAST_MIN_SAMPLES 6	// first trend after 30 minutes
+#define FORECAST_THRESHOLD 25	// Pa/h of rising or falling pressure
+
+extern int32_t forecast_trend;	// Pa/h
+
+void forecast_init(void);
+void forecast_sample(uint32_t pressure);
+char forecast_zambretti(int32_t pressure, int8_t month, bool north);
+int32_t forecast_seaLevel(int32_t pressure, int8_t temperature, int16_t altitude);
+
+#endif /* FORECAST_H_ */
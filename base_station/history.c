@@ -0,0 +1,192 @@
+/*
+ * Sensor history
+ *
+ * Created: 16-10-2026 20:05:18
+ *
+ * Keeps 24 hours of temperature and humidity per sensor in EEPROM, because
+ * SRAM is used up by the sensor table and the receive buffers. A sample is
+ * one byte: the zigzag encoded change of temperature in the low nibble and
+ * of humidity in the high nibble, in steps of HISTORY_TEMP_STEP and
+ * HISTORY_HUMID_STEP. Larger changes are clamped and caught up with in the
+ * next samples. 0xFF marks a sample without reading.
+ *
+ * Samples are numbered by time and the number selects the slot, so there is
+ * no head to store. Every slot has a stamp of its number, a slot with an old
+ * stamp, like the ones skipped during a power outage, holds no sample.
+ * Absolute values are only stored every HISTORY_ANCHOR samples, the values
+ * of newer samples follow from the changes since. A series that reports
+ * without value, because it was just enabled or missed the anchor, renews
+ * the anchor with the next sample. Storing a sample writes at most one byte
+ * per call and returns false while EEPROM is busy, so the main loop never
+ * waits for a write.
+ */
+
+#ifdef __AVR__
+#include <avr/eeprom.h>
+#else
+#include "eepromhost.h"	// emulated EEPROM, see tools/eepromhost.c
+#endif
+#include "nvram.h"
+
+#define NO_SAMPLE 0xFF
+#define NO_VALUE 0xFFFF
+
+uint32_t history_newest = HISTORY_NONE;
+static uint32_t anchor = HISTORY_NONE, current = HISTORY_NONE;
+static bool anchoring;	// current sample stores absolute values
+static bool waiting;	// a series reported without value, renew anchor with next sample
+static uint8_t cached = HISTORY_SERIES, sample;	// series of value and sample
+static history_value_t value;
+
+// zigzag encode change of value, limited to -7..7
+static uint8_t encode(int16_t diff, uint8_t step) {
+	int8_t delta = (diff < 0) ? -((-diff + step / 2) / step) : (diff + step / 2) / step;
+	if (delta > 7) delta = 7;
+	if (delta < -7) delta = -7;
+	return (delta < 0) ? -2 * delta - 1 : 2 * delta;
+}
+
+static int8_t decode(uint8_t nibble) {
+	return (nibble & 1) ? -(int8_t)((nibble + 1) >> 1) : nibble >> 1;
+}
+
+// true when slot of sample number holds that sample
+static bool stamped(uint32_t seq) {
+	return eeprom_read_byte(&nv.history.stamp[seq % HISTORY_SAMPLES]) == (uint8_t)(seq / HISTORY_SAMPLES);
+}
+
+static uint8_t readSample(uint32_t seq, uint8_t series) {
+	return (stamped(seq)) ? eeprom_read_byte(&nv.history.sample[seq % HISTORY_SAMPLES][series]) : NO_SAMPLE;
+}
+
+// write byte when EEPROM is ready, returns false to try again later
+static bool put(uint8_t *p, uint8_t data) {
+	if (!eeprom_is_ready()) return false;
+	if (eeprom_read_byte(p) != data) eeprom_write_byte(p, data);
+	return true;
+}
+
+// values of series at sample number, from the anchor and the changes since
+static history_value_t valueAt(uint8_t series, uint32_t seq) {
+	history_value_t v;
+	eeprom_read_block(&v, &nv.history.anchor[series], sizeof(v));
+	for (uint32_t n = anchor + 1; n <= seq && v.humid != NO_VALUE; n++) {
+		uint8_t s = readSample(n, series);
+		if (s == NO_SAMPLE) continue;
+		v.temp += decode(s & 0x0F) * HISTORY_TEMP_STEP;
+		v.humid += decode(s >> 4) * HISTORY_HUMID_STEP;
+	}
+	return v;
+}
+
+// forget all samples, when EEPROM held another layout
+void history_clear(void) {
+	eeprom_write_byte((uint8_t *)&nv.history.seq + 3, 0xFF);
+}
+
+// find newest sample after power up
+void history_init(void) {
+	history_newest = current = anchor = eeprom_read_dword(&nv.history.seq);
+	if ((anchor >> 24) == 0xFF || !stamped(anchor)) {
+		history_newest = current = anchor = HISTORY_NONE;
+		return;
+	}
+	// no sample is stored after the next anchor is due
+	for (uint8_t i = 1; i < HISTORY_ANCHOR; i++) {
+		if (stamped(anchor + i)) history_newest = current = anchor + i;
+	}
+}
+
+// start storing sample number, returns false when EEPROM is busy
+bool history_begin(uint32_t seq) {
+	bool renew = anchor == HISTORY_NONE || seq - anchor >= HISTORY_ANCHOR || waiting;
+	// a power loss while storing leaves either no anchor or an empty slot
+	if (renew && !put((uint8_t *)&nv.history.seq + 3, 0xFF)) return false;
+	if (!renew && !put(&nv.history.stamp[seq % HISTORY_SAMPLES], seq / HISTORY_SAMPLES - 2)) return false;
+	// samples of a lost history do not follow from the new anchor
+	for (uint8_t i = 0; history_newest == HISTORY_NONE && i < HISTORY_SAMPLES; i++) {
+		if (!put(&nv.history.stamp[i], seq / HISTORY_SAMPLES - 2)) return false;
+	}
+	current = seq;
+	anchoring = renew;
+	cached = HISTORY_SERIES;
+	return true;
+}
+
+// store sample of series, returns false when EEPROM is busy and the call has to be repeated
+bool history_append(uint8_t series, bool valid, int16_t temp, uint16_t humid) {
+	if (!eeprom_is_ready()) return false;
+	if (cached != series) {
+		// continue from previous sample, unless it is older than the history
+		value.humid = NO_VALUE;
+		if (history_newest != HISTORY_NONE && current - history_newest < HISTORY_SAMPLES)
+			value = valueAt(series, history_newest);
+		sample = NO_SAMPLE;
+		if (valid && value.humid == NO_VALUE && anchoring) {
+			value.temp = temp;
+			value.humid = humid;
+		}
+		if (valid && value.humid == NO_VALUE) waiting = true;
+		if (valid && value.humid != NO_VALUE) {
+			uint8_t t = encode(temp - value.temp, HISTORY_TEMP_STEP);
+			uint8_t h = encode(humid - value.humid, HISTORY_HUMID_STEP);
+			// rounding must not take humidity below zero, which would read as no value
+			if (decode(h) * HISTORY_HUMID_STEP < -(int16_t)value.humid) h = (h > 1) ? h - 2 : 0;
+			value.temp += decode(t) * HISTORY_TEMP_STEP;
+			value.humid += decode(h) * HISTORY_HUMID_STEP;
+			sample = (h << 4) | t;
+		}
+		cached = series;
+	}
+	if (!put(&nv.history.sample[current % HISTORY_SAMPLES][series], sample)) return false;
+	for (uint8_t i = 0; anchoring && i < sizeof(value); i++) {
+		if (!put((uint8_t *)&nv.history.anchor[series] + i, ((uint8_t *)&value)[i])) return false;
+	}
+	return true;
+}
+
+// finish sample after all series are appended, returns false when EEPROM is busy
+bool history_commit(void) {
+	if (!put(&nv.history.stamp[current % HISTORY_SAMPLES], current / HISTORY_SAMPLES)) return false;
+	// highest byte last, it marks the anchor valid
+	for (uint8_t i = 0; anchoring && i < sizeof(current); i++) {
+		if (!put((uint8_t *)&nv.history.seq + i, current >> (8 * i))) return false;
+	}
+	if (anchoring) {
+		anchor = current;
+		waiting = false;
+	}
+	history_newest = current;
+	return true;
+}
+
+static void read(history_iter_t *it) {
+	it->valid = readSample(it->seq, it->series) != NO_SAMPLE;
+}
+
+// start at newest sample of series, returns false when series has no values or a sample is being stored
+bool history_first(history_iter_t *it, uint8_t series) {
+	if (history_newest == HISTORY_NONE || current != history_newest) return false;
+	history_value_t v = valueAt(series, history_newest);
+	it->series = series;
+	it->seq = history_newest;
+	it->left = HISTORY_SAMPLES - 1;
+	it->temp = v.temp;
+	it->humid = v.humid;
+	read(it);
+	return it->humid != NO_VALUE;
+}
+
+// step back to previous sample, returns false when oldest sample was passed
+bool history_next(history_iter_t *it) {
+	if (!it->left) return false;
+	if (it->valid) {
+		uint8_t s = readSample(it->seq, it->series);
+		it->temp -= decode(s & 0x0F) * HISTORY_TEMP_STEP;
+		it->humid -= decode(s >> 4) * HISTORY_HUMID_STEP;
+	}
+	it->seq--;
+	it->left--;
+	read(it);
+	return true;
+}
@@ -0,0 +1,54 @@
+/*
+ * Sensor history
+ *
+ * Created: 16-10-2026 20:05:18
+ */
+
+
+#ifndef HISTORY_H_
+#define HISTORY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define HISTORY_SERIES 17	// remote sensors and base station
+#define HISTORY_SAMPLES 48	// 24 hours
+#define HISTORY_INTERVAL 30	// minutes between samples
+#define HISTORY_ANCHOR 8	// samples between absolute values
+#define HISTORY_TEMP_STEP 2	// 0.2 degrees
+#define HISTORY_HUMID_STEP 10	// 1 percent
+#define HISTORY_NONE 0xFFFFFFFF	// no sample number
+
+typedef struct {
+	int16_t temp;
+	uint16_t humid;
+} history_value_t;
+
+// EEPROM budget of the ATmega328P is 1024 bytes, see nvram.h: names 64,
+// touch screen calibration 8, magic 1, time zone 12, this store 936, 3 free
+typedef struct {
+	uint8_t stamp[HISTORY_SAMPLES];	// low byte of sample number / HISTORY_SAMPLES
+	uint8_t sample[HISTORY_SAMPLES][HISTORY_SERIES];
+	history_value_t anchor[HISTORY_SERIES];	// values at sample number seq
+	uint32_t seq;	// highest byte is 0xFF while anchor is written
+} history_store_t;
+
+typedef struct {
+	uint32_t seq;		// sample number, minutes since 2000 / HISTORY_INTERVAL
+	uint8_t series, left;
+	bool valid;		// false when sensor did not report
+	int16_t temp;
+	uint16_t humid;
+} history_iter_t;
+
+extern uint32_t history_newest;
+
+void history_clear(void);
+void history_init(void);
+bool history_begin(uint32_t seq);
+bool history_append(uint8_t series, bool valid, int16_t temp, uint16_t humid);
+bool history_commit(void);
+bool history_first(history_iter_t *it, uint8_t series);
+bool history_next(history_iter_t *it);
+
+#endif /* HISTORY_H_ */
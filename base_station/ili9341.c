@@ -19,18 +19,26 @@
 #define F_CPU 12000000
 #endif
 
+#ifdef __AVR__
 #include <avr/io.h>
 #include <avr/pgmspace.h>
 #include <avr/sfr_defs.h>
 #include <util/delay.h>
+#else
+#include "ili9341host.h"	// emulated display, see tools/ili9341host.c
+#endif
 #include <stdlib.h>	// abs()
+#include <string.h>	// strlen()
 #include "ili9341.h"
 
-const uint8_t *font;
+const uint8_t *font, *font_index;
 uint8_t textsize = 1;
 uint16_t cursor_x = 0, cursor_y = 0, font_size;
 uint16_t textcolor = ILI9341_WHITE, textbgcolor = ILI9341_WHITE;
 uint16_t _width = ILI9341_TFTWIDTH, _height = ILI9341_TFTHEIGHT;
+// Current address window, column or page range is not sent again when unchanged
+static uint16_t win_x1 = 0xFFFF, win_x2, win_y1 = 0xFFFF, win_y2;
+static uint16_t saved_bytes;
 
 static const uint8_t init_commands[] PROGMEM = {
 	4, 0xEF, 0x03, 0x80, 0x02,
@@ -57,12 +65,19 @@ static const uint8_t init_commands[] PROGMEM = {
 	0
 };
 
+#ifdef __AVR__
 #define FAST_SPI // Enable fast SPI writing optimizations for Fck/2 double speed mode
+#endif
 //#define ROUND_RECT // Use rounded rectangle functions to draw circles
 //#define TRANSPARENT // Enable transparent character drawing
 
+#ifdef __AVR__
 #define spi_begin() PORTD &= ~_BV(PD7) // CS low
 #define spi_end() PORTD |= _BV(PD7) // CS high
+#else
+#define spi_begin() ili9341host_select(false)
+#define spi_end() ili9341host_select(true)
+#endif
 
 // Send 8 bit value
 inline void spiwrite(uint8_t data) {
@@ -79,14 +94,19 @@ inline void spiwrite(uint8_t data) {
 		"rjmp .+0\n\t"
 		"nop\n\t"
 	);
-#else
+#elif defined(__AVR__)
 	SPDR = data;
 	loop_until_bit_is_set(SPSR, SPIF);
+#else
+	SPDR = ili9341host_spi(data);
 #endif
 }
 
 // Send 16 bit value multiple times
 inline void spiwrite16(uint16_t data, uint16_t count) {
+#ifndef __AVR__
+	ili9341host_cost.writes++;
+#endif
 #ifdef FAST_SPI
 	asm volatile (
 		"sbiw %[count],0\n\t"		// test count
@@ -167,6 +187,24 @@ inline uint8_t spiread(void) {
 	return SPDR;
 }
 
+// Pixels of the same color are merged into runs that are sent at once
+static uint16_t run_color, run_count;
+
+static inline void flushRun(void) {
+	if (run_count == 0) return;
+	spiwrite16(run_color, run_count);
+	run_count = 0;
+}
+
+static inline void pushRun(uint16_t color, uint16_t count) {
+	if (count == 0) return;
+	if (color != run_color) {
+		flushRun();
+		run_color = color;
+	}
+	run_count += count;
+}
+
 // Send command and deselect
 static void writecommand(uint8_t com) {
 	PORTD &= ~_BV(PD6); // set DC low to send command
@@ -241,6 +279,7 @@ void ili9341_init(void) {
 	writecommand(ILI9341_SLPOUT);    // Exit Sleep
 	_delay_ms(5);
 	writecommand(ILI9341_DISPON);    // Display on
+	win_x1 = win_y1 = 0xFFFF;
 }
 
 // 8-bit read mode for read ID or register commands, 24 and 32 bit is not supported
@@ -253,16 +292,33 @@ uint8_t ili9341_readcommand8(uint8_t com) {
 
 //set coordinate for print or other function
 void ili9341_setaddress(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-	writecommand_cont(ILI9341_CASET);
-	writedata16_cont(x1);
-	writedata16_cont(x2);
-	writecommand_cont(ILI9341_PASET);
-	writedata16_cont(y1);
-	writedata16_cont(y2);
-	writecommand_cont(ILI9341_RAMWR); // memory write
+	if (x1 != win_x1 || x2 != win_x2) {
+		writecommand_cont(ILI9341_CASET);
+		writedata16_cont(x1);
+		writedata16_cont(x2);
+		win_x1 = x1;
+		win_x2 = x2;
+	} else
+		saved_bytes += 5;
+	if (y1 != win_y1 || y2 != win_y2) {
+		writecommand_cont(ILI9341_PASET);
+		writedata16_cont(y1);
+		writedata16_cont(y2);
+		win_y1 = y1;
+		win_y2 = y2;
+	} else
+		saved_bytes += 5;
+	writecommand_cont(ILI9341_RAMWR); // memory write, also restarts at window origin
 	spi_end();
 }
 
+// Command bytes not sent because the address window was unchanged, since last call
+uint16_t ili9341_savedBytes(void) {
+	uint16_t saved = saved_bytes;
+	saved_bytes = 0;
+	return saved;
+}
+
 // Reads one pixel/color from the TFT's GRAM
 uint16_t ili9341_readPixel(uint16_t x, uint16_t y) {
 	ili9341_setaddress(x,y,x+1,y+1);
@@ -272,6 +328,7 @@ uint16_t ili9341_readPixel(uint16_t x, uint16_t y) {
 	uint8_t green = read8_cont();
 	uint8_t blue = read8_cont();
 	spi_end();
+	win_x1 = win_y1 = 0xFFFF;
 	return color565(red, green, blue);
 }
 
@@ -288,6 +345,7 @@ void ili9341_readRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *
 		*pcolors++ = color565(red, green, blue);
 	}
 	spi_end();
+	win_x1 = win_y1 = 0xFFFF;
 }
 
 // Write multiple pixels
@@ -356,6 +414,7 @@ void ili9341_fillrect(uint16_t x,uint16_t y,uint16_t w,uint16_t h,uint16_t color
 
 //rotate screen at desired orientation (0-3)
 void ili9341_setRotation(uint8_t m) {
+	win_x1 = win_y1 = 0xFFFF;
 	writecommand(ILI9341_MADCTL);
 	switch (m) {
 		case 0:
@@ -414,16 +473,36 @@ void ili9341_drawRect(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height,
 	ili9341_drawvline(x0+width-1, y0, height, color);
 }
 
+// Fill rectangle that may start left of or above the screen
+static void fillClipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+	if (x < 0) {
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		h += y;
+		y = 0;
+	}
+	if (w > 0 && h > 0) ili9341_fillrect(x, y, w, h, color);
+}
+
+// Draw straight run of circle points from dx1,dy1 to dx2,dy2 mirrored in all quadrants
+static void circleRun(int16_t x0, int16_t y0, int16_t dx1, int16_t dx2, int16_t dy1, int16_t dy2, uint16_t color) {
+	int16_t w = dx2 - dx1 + 1, h = dy2 - dy1 + 1;
+	fillClipped(x0 + dx1, y0 + dy1, w, h, color);
+	fillClipped(x0 - dx2, y0 + dy1, w, h, color);
+	fillClipped(x0 - dx2, y0 - dy2, w, h, color);
+	fillClipped(x0 + dx1, y0 - dy2, w, h, color);
+}
+
 void ili9341_drawCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
 #ifdef ROUND_RECT
 	ili9341_drawRoundRect(x0-r, y0-r, 2*r+1, 2*r+1, r, color);
 #else
 	int16_t x = -r, y = 0, err = 2-2*r, e2;
+	int16_t sx = r, sy = 0; // start of run of points in a straight line
 	do {
-		ili9341_drawpixel(x0-x, y0+y,color);
-		ili9341_drawpixel(x0+x, y0+y,color);
-		ili9341_drawpixel(x0+x, y0-y,color);
-		ili9341_drawpixel(x0-x, y0-y,color);
+		int16_t px = -x, py = y;
 		e2 = err;
 		if (e2 <= y) {
 			err += ++y*2+1;
@@ -431,6 +510,12 @@ void ili9341_drawCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
 		}
 		if (e2 > x)
 			err += ++x*2+1;
+		// draw run when next point does not extend it
+		if (x > 0 || !((-x == sx && px == sx) || (y == sy && py == sy))) {
+			circleRun(x0, y0, px, sx, sy, py, color);
+			sx = -x;
+			sy = y;
+		}
 	} while (x <= 0);
 #endif
 }
@@ -439,10 +524,14 @@ void ili9341_fillCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
 #ifdef ROUND_RECT
 	ili9341_fillRoundRect(x0-r, y0-r, 2*r+1, 2*r+1, r, color);
 #else
-	int16_t x = -r, y = 0, err = 2-2*r, e2;
+	int16_t x = -r, y = 0, err = 2-2*r, e2, row = 0;
 	do {
-		ili9341_drawvline(x0-x, y0-y, 2*y, color);
-		ili9341_drawvline(x0+x, y0-y, 2*y, color);
+		// first point of a row is the widest, draw row above and below center
+		if (y != row) {
+			fillClipped(x0+x, y0-y, 1-2*x, 1, color);
+			fillClipped(x0+x, y0+y-1, 1-2*x, 1, color);
+			row = y;
+		}
 		e2 = err;
 		if (e2 <= y) {
 			err += ++y*2+1;
@@ -454,6 +543,40 @@ void ili9341_fillCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color) {
 #endif
 }
 
+#define MAX_EXTENT_RADIUS 32 // largest radius of circle filled in one window
+
+// Fill circle and the rest of its bounding box with bg in one address window
+void ili9341_fillCircleBg(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color, uint16_t bg) {
+	uint8_t extent[MAX_EXTENT_RADIUS + 1]; // half width of rows above and below center
+	int16_t x = -r, y = 0, err = 2-2*r, e2, row = 0;
+	if (r == 0) return;
+	if (r > MAX_EXTENT_RADIUS || x0 < r || y0 < r || x0 + r >= _width || y0 + r > _height) {
+		fillClipped(x0 - r, y0 - r, 2*r+1, 2*r, bg);
+		ili9341_fillCircle(x0, y0, r, color);
+		return;
+	}
+	do {
+		if (y != row) extent[row = y] = -x; // first point of a row is the widest
+		e2 = err;
+		if (e2 <= y) {
+			err += ++y*2+1;
+			if (-x == y && e2 <= x) e2 = 0;
+		}
+		if (e2 > x)
+			err += ++x*2+1;
+	} while (x <= 0);
+	ili9341_setaddress(x0 - r, y0 - r, x0 + r, y0 + r - 1);
+	spi_begin();
+	for (row = -r; row < (int16_t)r; row++) {
+		uint8_t w = extent[(row < 0) ? -row : row + 1];
+		pushRun(bg, r - w);
+		pushRun(color, 2*w + 1);
+		pushRun(bg, r - w);
+	}
+	flushRun();
+	spi_end();
+}
+
 // if true, TFT will be blank (white), displays frame buffer is unaffected
 // (you can write to it without showing content on the screen)
 void ili9341_display(bool d) {
@@ -523,8 +646,11 @@ void ili9341_fillEllipse(uint16_t x0, uint16_t y0, int16_t rx, int16_t ry, uint1
 	int32_t fy2 = 4 * ry2;
 	int32_t s;
 	for (x = 0, y = ry, s = 2*ry2+rx2*(1-2*ry); ry2*x <= rx2*y; x++) {
-		ili9341_drawhline(x0 - x, y0 - y, x + x + 1, color);
-		ili9341_drawhline(x0 - x, y0 + y, x + x + 1, color);
+		// only the last and widest span of a row is drawn
+		if (s >= 0 || ry2*(x+1) > rx2*y) {
+			fillClipped(x0 - x, y0 - y, x + x + 1, 1, color);
+			fillClipped(x0 - x, y0 + y, x + x + 1, 1, color);
+		}
 		if (s >= 0) {
 			s += fx2 * (1 - y);
 			y--;
@@ -532,8 +658,8 @@ void ili9341_fillEllipse(uint16_t x0, uint16_t y0, int16_t rx, int16_t ry, uint1
 		s += ry2 * ((4 * x) + 6);
 	}
 	for (x = rx, y = 0, s = 2*rx2+ry2*(1-2*rx); rx2*y <= ry2*x; y++) {
-		ili9341_drawhline(x0 - x, y0 - y, x + x + 1, color);
-		ili9341_drawhline(x0 - x, y0 + y, x + x + 1, color);
+		fillClipped(x0 - x, y0 - y, x + x + 1, 1, color);
+		if (y) fillClipped(x0 - x, y0 + y, x + x + 1, 1, color);
 		if (s >= 0) {
 			s += fy2 * (1 - x);
 			x--;
@@ -712,12 +838,14 @@ void ili9341_fillRoundRect(uint16_t x, uint16_t y, uint16_t width, uint16_t heig
 	// center block
 	ili9341_fillrect(x+radius, y, width-2*radius, height, color);
 	while (x1 <= y1) {
-		// left side
+		// left and right side
 		ili9341_drawvline(x+radius - x1, y+radius - y1, delta + 2*y1+1, color);
-		ili9341_drawvline(x+radius - y1, y+radius - x1, delta + 2*x1+1, color);
-		// right side
 		ili9341_drawvline(x+width-radius-1 + x1, y+radius - y1, delta + 2*y1+1, color);
-		ili9341_drawvline(x+width-radius-1 + y1, y+radius - x1, delta + 2*x1+1, color);
+		// outer columns are drawn once, with the height of the last step
+		if (tSwitch >= 0 || x1 + 1 > y1) {
+			fillClipped(x+radius - y1, y+radius - x1, 1, delta + 2*x1+1, color);
+			fillClipped(x+width-radius-1 + y1, y+radius - x1, 1, delta + 2*x1+1, color);
+		}
 		if (tSwitch < 0) {
 			tSwitch += (4 * x1 + 6);
 		} else {
@@ -729,34 +857,45 @@ void ili9341_fillRoundRect(uint16_t x, uint16_t y, uint16_t width, uint16_t heig
 }
 
 void ili9341_setFont(const uint8_t *f) {
+	ili9341_setFontIndex(f, NULL);
+}
+
+// Set font with glyph offset table generated by tools/fontindex.c
+void ili9341_setFontIndex(const uint8_t *f, const uint8_t *index) {
 	font = f;
+	font_index = index;
 	font_size = (readFontByte(&font[FONT_LENGTH]) << 8) | readFontByte(&font[FONT_LENGTH+1]);
 }
 
+// Locate data of character c relative to first character and read its width
+static const uint8_t *glyphData(uint8_t c, uint8_t *width) {
+	const uint8_t *base = &font[FONT_WIDTH_TABLE];
+	uint8_t bytes = (readFontByte(&font[FONT_HEIGHT]) + 7) / 8; // calculates height in rounded up bytes
+	if (font_size < 2) {
+		// Fixed width font
+		*width = readFontByte(&font[FONT_WIDTH]);
+		return base + c * bytes * *width;
+	}
+	// Proportional font, read width data, to get the index
+	*width = readFontByte(base + c);
+	if (font_index)
+		return font + ((readFontByte(&font_index[2*c]) << 8) | readFontByte(&font_index[2*c+1]));
+	uint16_t index = 0;
+	for (uint8_t i = 0; i < c; i++)
+		index += readFontByte(base + i);
+	return base + bytes*index + readFontByte(&font[FONT_CHAR_COUNT]);
+}
+
 // Draw openGLCD font character
 void ili9341_drawChar(uint16_t x, uint16_t y, unsigned char c, uint16_t fgcolor, uint16_t bgcolor, uint8_t size) {
-	uint8_t font_width = readFontByte(&font[FONT_WIDTH]);
+	uint8_t font_width;
 	uint8_t font_height = readFontByte(&font[FONT_HEIGHT]);
-	uint8_t font_first = readFontByte(&font[FONT_FIRST_CHAR]);
-	uint8_t font_count = readFontByte(&font[FONT_CHAR_COUNT]);
-	const uint8_t *base = &font[FONT_WIDTH_TABLE];
+	const uint8_t *base = glyphData(c - readFontByte(&font[FONT_FIRST_CHAR]), &font_width);
 	uint8_t padding = (font_size == 1) ? 0 : 1; // size of one indicates fixed width no pixel padding
 	uint8_t bytes = (font_height + 7) / 8; // calculates height in rounded up bytes
 	uint8_t shift = 0;
-	c -= font_first;
-	if (font_size < 2) {
-		// Fixed width font
-		base += c * bytes * font_width;
-	} else {
-		// Proportional font, read width data, to get the index
-		font_width = readFontByte(base + c);
-		if (font_height & 7)
-			shift = 8 - (font_height & 7); // FontCreator shifts residual font bits the wrong direction
-		uint16_t index = 0;
-		for (uint8_t i = 0; i < c; i++)
-			index += readFontByte(base + i);
-		base += bytes*index + font_count;
-	}
+	if (font_size > 1 && (font_height & 7))
+		shift = 8 - (font_height & 7); // FontCreator shifts residual font bits the wrong direction
 	if ((x+font_width*size > _width) || (y+font_height*size > _height)) return;
 	if (fgcolor == bgcolor) {
 #ifdef TRANSPARENT
@@ -800,9 +939,8 @@ void ili9341_drawChar(uint16_t x, uint16_t y, unsigned char c, uint16_t fgcolor,
 		for (uint8_t h=font_height; h > 0; h--) {
 			for (uint8_t yr=0; yr < size; yr++) {
 				for (uint8_t w=0; w < font_width; w++)
-					spiwrite16((readFontByte(&base[w]) & mask) ? fgcolor : bgcolor, size);
-				// extra pixels on right for spacing
-				spiwrite16(bgcolor, padding * size);
+					pushRun((readFontByte(&base[w]) & mask) ? fgcolor : bgcolor, size);
+				pushRun(bgcolor, padding * size); // extra pixels on right for spacing
 			}
 			mask <<= 1;
 			if (mask == 0) {
@@ -813,8 +951,8 @@ void ili9341_drawChar(uint16_t x, uint16_t y, unsigned char c, uint16_t fgcolor,
 					mask = 0x01;
 			}
 		}
-		if (padding)
-			spiwrite16(bgcolor, (font_width+padding) * size * size); // extra pixels below for spacing
+		pushRun(bgcolor, padding * (font_width+padding) * size * size); // extra pixels below for spacing
+		flushRun();
 		spi_end();
 	}
 }
@@ -857,28 +995,30 @@ void ili9341_drawXBitmap(uint16_t x, uint16_t y, const char bitmap[], uint16_t w
 	}
 }
 
-// Draw compressed monochrome bitmap
+// Draw compressed monochrome bitmap, see tools/rleencode.c
 void ili9341_drawRLEBitmap(uint16_t x, uint16_t y, const char bitmap[], uint16_t w, uint16_t h, uint16_t color, uint16_t bg) {
 	ili9341_setaddress(x, y, x+w-1, y+h-1);
 	spi_begin();
-	int32_t c = w * h;
+	int32_t c = (int32_t)w * h;
+	// pixels of the same color are merged into runs, also across encoded bytes
 	while (c > 0) {
 		uint8_t byte = pgm_read_byte(bitmap++);
 		// bit 7 is the encoding type: RLE or plain
 		if (byte & 0x80) {
 			// bits 0-5 is the length (1-64) and bit 6 is the value
 			uint8_t repeat = (byte & 0x3f) + 1;
-			spiwrite16((byte & 0x40) ? color : bg, repeat);
+			pushRun((byte & 0x40) ? color : bg, repeat);
 			c -= repeat;
 		} else {
 			// Bit order left-to-right = LSB to MSB:
 			for (uint8_t i = 0; i < 7; i++) {
-				writedata16_cont((byte & 0x1) ? color : bg);
+				pushRun((byte & 0x1) ? color : bg, 1);
 				byte >>= 1;
-				c--;
 			}
+			c -= 7;
 		}
 	}
+	flushRun();
 	spi_end();
 }
 
@@ -932,6 +1072,14 @@ uint8_t ili9341_fontHeight(void) {
 	return font_height * textsize;
 }
 
+// Width of character including padding pixels, zero if not in font
+static uint8_t charAdvance(char c) {
+	uint8_t font_first = readFontByte(&font[FONT_FIRST_CHAR]);
+	uint8_t font_count = readFontByte(&font[FONT_CHAR_COUNT]);
+	if (c < font_first || c >= (font_first + font_count)) return 0;
+	return ili9341_charWidth(c) + ((font_size != 1) ? textsize : 0);
+}
+
 uint8_t ili9341_charWidth(char c) {
 	uint8_t font_width, font_first = readFontByte(&font[FONT_FIRST_CHAR]);
 	uint8_t font_count = readFontByte(&font[FONT_CHAR_COUNT]);
@@ -945,39 +1093,107 @@ uint8_t ili9341_charWidth(char c) {
 
 size_t ili9341_strWidth(const char *string) {
 	size_t sw = 0;
-	while (*string) {
-		uint8_t cw = ili9341_charWidth(*string++);
-		if (cw == 0) continue;
-		sw += cw;
-		if (font_size != 1) sw+=textsize;
-	}
+	while (*string)
+		sw += charAdvance(*string++);
 	return sw;
 }
 
 size_t ili9341_strWidth_p(const char *string) {
 	size_t sw = 0;
 	register char c;
-	while ((c = pgm_read_byte(string++))) {
-		uint8_t cw = ili9341_charWidth(c);
-		if (cw == 0) continue;
-		sw += cw;
-		if (font_size != 1) sw+=textsize;
-	}
+	while ((c = pgm_read_byte(string++)))
+		sw += charAdvance(c);
 	return sw;
 }
 
+#define min(a,b) ((a)<(b)?(a):(b))
+#define NO_CLEAR 0xFFFF
+
+// Draw string from SRAM or flash at cursor in one address window and clear area
+// right of it up to x in the same window. Rows are streamed across all glyphs.
+static void drawString(const char *string, bool pgm, uint16_t x) {
+	uint8_t font_height = readFontByte(&font[FONT_HEIGHT]);
+	uint8_t font_first = readFontByte(&font[FONT_FIRST_CHAR]);
+	uint8_t font_count = readFontByte(&font[FONT_CHAR_COUNT]);
+	uint8_t padding = (font_size == 1) ? 0 : 1;
+	uint8_t bytes = (font_height + 7) / 8;
+	uint8_t shift = 0;
+	uint16_t w = (pgm) ? ili9341_strWidth_p(string) : ili9341_strWidth(string);
+	uint16_t fill = 0;
+	char c;
+	if (font_size > 1 && (font_height & 7))
+		shift = 8 - (font_height & 7);
+	if (w == 0 || textcolor == textbgcolor || cursor_x + w > _width || cursor_y + (font_height + padding) * textsize > _height
+		|| ((pgm) ? strchr_P(string, '\n') : strchr(string, '\n'))) {
+		// draw character by character
+		while ((c = (pgm) ? pgm_read_byte(string++) : *string++))
+			ili9341_write(c);
+		if (x != NO_CLEAR) ili9341_clearTextArea(x);
+		return;
+	}
+	if (x != NO_CLEAR && x > cursor_x + w)
+		fill = min(x, _width) - cursor_x - w;
+	ili9341_setaddress(cursor_x, cursor_y, cursor_x + w + fill - 1, cursor_y + (font_height + padding) * textsize - 1);
+	spi_begin();
+	for (uint8_t h = 0; h < font_height; h++) {
+		// FontCreator shifts residual bits of the last byte row
+		uint8_t mask = 0x01 << (h & 7);
+		if (shift && h >= 8 && h / 8 == bytes - 1)
+			mask <<= shift;
+		for (uint8_t yr = 0; yr < textsize; yr++) {
+			for (const char *s = string; (c = (pgm) ? pgm_read_byte(s) : *s); s++) {
+				if (c < font_first || c >= (font_first + font_count)) continue;
+				uint8_t font_width;
+				const uint8_t *base = glyphData(c - font_first, &font_width) + (h / 8) * font_width;
+				for (uint8_t i = 0; i < font_width; i++)
+					pushRun((readFontByte(&base[i]) & mask) ? textcolor : textbgcolor, textsize);
+				pushRun(textbgcolor, padding * textsize);
+			}
+			pushRun(textbgcolor, fill);
+		}
+	}
+	pushRun(textbgcolor, padding * (w + fill) * textsize);
+	flushRun();
+	spi_end();
+	cursor_x += w;
+	if (x != NO_CLEAR && x < cursor_x) ili9341_clearTextArea(x);
+}
+
 void ili9341_puts(const char *string) {
-	while(*string)
-		ili9341_write(*string++);
+	drawString(string, false, NO_CLEAR);
 }
 
 void ili9341_puts_p(const char *string) {
-	register char c;
-	while ((c = pgm_read_byte(string++)))
-		ili9341_write(c);
+	drawString(string, true, NO_CLEAR);
 }
 
-#define min(a,b) ((a)<(b)?(a):(b))
+// Draw string and clear area from end of string to x, like ili9341_clearTextArea()
+void ili9341_putsClear(const char *string, uint16_t x) {
+	drawString(string, false, x);
+}
+
+void ili9341_putsClear_p(const char *string, uint16_t x) {
+	drawString(string, true, x);
+}
+
+// Draw string at cursor where old string was drawn before with the same colors.
+// Leading characters that are equal are skipped. For fixed width fonts every
+// equal character cell is skipped when both strings have the same length.
+void ili9341_putsDiff(const char *old, const char *string) {
+	bool cells = font_size < 2 && strlen(old) == strlen(string);
+	while (*string) {
+		if (*string == *old) {
+			cursor_x += charAdvance(*string);
+		} else if (cells) {
+			ili9341_write(*string);
+		} else {
+			break;
+		}
+		string++;
+		old++;
+	}
+	ili9341_puts(string);
+}
 
 // Clears area from x to cursor
 void ili9341_clearTextArea(uint16_t x) {
@@ -12,6 +12,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "fonts/allFonts.h"
+#include "fonts/fontIndex.h"
 
 #define ILI9341_TFTWIDTH   240      // ILI9341 max TFT width
 #define ILI9341_TFTHEIGHT  320      // ILI9341 max TFT height
@@ -221,6 +222,7 @@
 
 void ili9341_init();
 uint8_t ili9341_readcommand8(uint8_t com);
+uint16_t ili9341_savedBytes(void);
 uint16_t ili9341_readPixel(uint16_t x, uint16_t y);
 void ili9341_readRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *pcolors);
 void ili9341_writeRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t *pcolors);
@@ -236,6 +238,7 @@ void ili9341_drawLineByAngle(uint16_t x, uint16_t y, int16_t angle, int16_t leng
 void ili9341_drawRect(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height, uint16_t color);
 void ili9341_drawCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color);
 void ili9341_fillCircle(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color);
+void ili9341_fillCircleBg(uint16_t x0, uint16_t y0, uint16_t r, uint16_t color, uint16_t bg);
 void ili9341_display(bool d);
 void ili9341_sleep(bool s);
 void ili9341_idle(bool i);
@@ -254,6 +257,7 @@ void ili9341_drawXBitmap(uint16_t x, uint16_t y, const char bitmap[], uint16_t w
 void ili9341_drawRLEBitmap(uint16_t x, uint16_t y, const char bitmap[], uint16_t w, uint16_t h, uint16_t color, uint16_t bg);
 void ili9341_drawChar(uint16_t x, uint16_t y, unsigned char c, uint16_t fgcolor, uint16_t bgcolor, uint8_t size);
 void ili9341_setFont(const uint8_t *f);
+void ili9341_setFontIndex(const uint8_t *f, const uint8_t *index);
 void ili9341_setCursor(uint16_t x, uint16_t y);
 void ili9341_getCursor(uint16_t *x, uint16_t *y);
 void ili9341_setTextColor(uint16_t color, uint16_t bg);
@@ -265,6 +269,9 @@ size_t ili9341_strWidth(const char *string);
 size_t ili9341_strWidth_p(const char *string);
 void ili9341_puts(const char *string);
 void ili9341_puts_p(const char *string);
+void ili9341_putsDiff(const char *old, const char *string);
+void ili9341_putsClear(const char *string, uint16_t x);
+void ili9341_putsClear_p(const char *string, uint16_t x);
 void ili9341_clearTextArea(uint16_t x);
 
 #endif /* ILI9341_H_ */
\ No newline at end of file
@@ -42,6 +42,8 @@
 #include <avr/interrupt.h>
 #include <avr/eeprom.h>
 #include <util/crc16.h>
+#include <util/atomic.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
@@ -52,6 +54,13 @@
 #include "suart.h"
 #include "gps.h"
 #include "xpt2046.h"
+#include "profile.h"
+#include "history.h"
+#include "forecast.h"
+#include "units.h"
+#include "calendar.h"
+#include "tz.h"
+#include "nvram.h"
 
 char buffer[26];
 
@@ -74,26 +83,70 @@ typedef struct {
 	uint16_t crc;
 } packet_t;
 
+_Static_assert(sizeof(packet_t) == UART_RX0_FRAME_SIZE, "UART frame size must match packet_t");
+
 typedef struct {
 	uint16_t min_humid, max_humid;
 	int16_t min_temp, max_temp;
 } history_t;
 
 typedef struct {
-	bool enabled;
-	uint16_t age;
-	unit_t unit;
-	uint16_t humid;
-	int16_t temp;
 	history_t hist[4];
-	char name[4];
-} sensor_t;
+	history_t day;		// last 24 hours, kept up to date with hist
+} extremes_t;
 
-#define SENSOR_COUNT 16 // times 44 bytes = 704 bytes
+typedef struct {
+	int16_t temp;
+	uint16_t humid;
+} reading_t;
+
+#define SENSOR_COUNT 16 // times 47 bytes = 752 bytes
+#if SENSOR_COUNT >= HISTORY_SERIES
+#error "HISTORY_SERIES must include the base station"
+#endif
+#if SENSOR_COUNT > 16
+#error "remote_enabled has one bit per sensor"
+#endif
+#if SENSOR_COUNT != NV_NAMES
+#error "EEPROM layout has a name per sensor"
+#endif
+#define SENSOR_BIT(i) ((uint16_t)1 << (i))
 packet_t rxData;
-sensor_t local, remote[SENSOR_COUNT];
+// remote sensors, names are read from EEPROM when needed
+uint16_t remote_enabled;
+uint16_t remote_seen[SENSOR_COUNT];	// uptime of last packet
+unit_t remote_unit[SENSOR_COUNT];
+reading_t remote_reading[SENSOR_COUNT];
+extremes_t remote_extremes[SENSOR_COUNT], local;
+
+// highest and lowest values for rainbow colors
+typedef struct {
+	int16_t h_temp, l_temp;
+	uint16_t h_humid, l_humid;
+} range_t;
+
+range_t remote_range = {INT16_MIN, INT16_MAX, 0, UINT16_MAX}; // of enabled remote sensors
 uint8_t period = 0, max_period = 1;
-char EEMEM nv_names[SENSOR_COUNT][4];
+nvram_t EEMEM nv;
+_Static_assert(offsetof(nvram_t, magic) == 72, "names and calibration must stay at their old offsets");
+_Static_assert(sizeof(nvram_t) <= E2END + 1, "EEPROM layout must fit");
+
+// last drawn values of a row on the main screen
+typedef struct {
+	uint8_t id, y;		// id is 0xFF when row needs a full redraw
+	unit_t unit;
+	int16_t temp;
+	uint16_t humid;
+	uint16_t temp_color, humid_color;
+	uint8_t version;	// of range the colors were calculated with
+	history_t day;
+} shown_t;
+
+#define SHOWN_COUNT 6 // rows below are always fully drawn
+#define NOT_SHOWN INT16_MIN
+shown_t shown_local, shown_remote[SHOWN_COUNT];
+int16_t shown_pres;
+time_t shown_time;
 
 typedef struct {
 	bool update_screen;
@@ -104,10 +157,12 @@ typedef struct {
 
 volatile action_t action;
 volatile uint16_t millis=0;
+volatile uint16_t uptime=0; // seconds
 
 typedef struct {
-	uint8_t value;
-	uint8_t touch;
+	uint8_t value:4;
+	uint8_t touch:4;
+	uint8_t shown;	// last drawn look, two bits per button of a radio group
 } button_t;
 
 typedef enum {SCREEN, MENU, CALIBRATE} view_t;
@@ -115,41 +170,52 @@ typedef enum {SCREEN, MENU, CALIBRATE} view_t;
 view_t view = SCREEN;
 enum {TAB_CONFIG = 1, TAB_LCD, TAB_ETC, TAB_NAMES};
 enum {THEME_LIGHT = 1, THEME_DARK, THEME_AUTO};
-enum {DEG_CELSIUS = 1, DEG_FAHRENHEIT};
-enum {PRESSURE_HPA = 1, PRESSURE_MMHG, PRESSURE_INHG, PRESSURE_PSI};
 bool dst = true, old_auto_led, is_day = false, refresh, north, old_rainbow;
+bool time_set; // system time is set from GPS, history waits for it
+bool redraw, redraw_menu; // draw all widgets in this pass, menu or calibrate screen was cleared
 button_t b_dst = {.value = true}, b_auto_led = {.value = true};
 button_t b_theme = {.value = THEME_AUTO}, b_pressure = {.value = PRESSURE_HPA};
 button_t b_degrees = {.value = DEG_CELSIUS}, b_rainbow = {.value = true};
-int8_t tz = 1, new_tz = 1;
+#define DEFAULT_ZONE 15 // Central European Time
+uint8_t zone = DEFAULT_ZONE, new_zone = DEFAULT_ZONE;
 uint8_t old_ocr0b, rotation = 3, old_theme, old_pressure, old_degrees;
 int16_t altitude;
+
+#define NO_DAY 0xFFFF
+// sun times of one day, calculated again when the day or position changes
+struct {
+	uint16_t day;		// days since epoch of solar noon, NO_DAY when not calculated
+	int16_t lat, lon;	// position in arc minutes
+	time_t sunrise, sunset;
+	uint8_t rise[3], set[3];	// local hour, minute and second
+	int8_t month;		// local month at solar noon
+} sun = {.day = NO_DAY};
 uint16_t fgcolor = ILI9341_WHITE, bgcolor = ILI9341_BLACK;
 
 const char keys1[] PROGMEM = "1234567890qwertyuiopasdfghjkl\x1Ezxcvbnm\x19\x1B";
 const char keys2[] PROGMEM = "!@#$%^&*()QWERTYUIOPASDFGHJKL\x1EZXCVBNM\x18\x1B";
+#define KEY_COUNT 39
+#define KEY_SHIFT 29
+#define NO_KEY 0xff
 
 const char no_gps_icon[] PROGMEM = {
-	0x90, 0x63, 0x90, 0x77, 0x91, 0x1f, 0x91, 0x07, 0x8f, 0x1f, 0x7c, 0x88,
-	0x77, 0x7c, 0x07, 0x18, 0x76, 0x7d, 0x8d, 0x07, 0x22, 0x89, 0x07, 0x78,
-	0x88, 0x1f, 0x7c, 0x03, 0x78, 0x79, 0x0f, 0x40, 0x1f, 0x70, 0x88, 0x3f,
-	0x60, 0x04, 0x70, 0x07, 0x72, 0x00, 0x7f, 0x10, 0x06, 0x78, 0x0f, 0x71,
-	0x00, 0xc7, 0x40, 0x03, 0x78, 0x1f, 0x18, 0x40, 0xc9, 0x18, 0x00, 0xce,
-	0x8a, 0xcb, 0x8c, 0xc9, 0x90, 0x0f, 0x00
+	0x90, 0x63, 0x90, 0x77, 0x91, 0xc4, 0x93, 0xc2, 0x93, 0x1f, 0x7c, 0x88,
+	0x77, 0x7c, 0x07, 0x18, 0x76, 0x7d, 0x8c, 0x0e, 0x44, 0x8a, 0x07, 0x78,
+	0x88, 0xc4, 0x83, 0xc6, 0x87, 0x1f, 0xc7, 0x88, 0xc5, 0x40, 0x03, 0x70,
+	0x07, 0x4c, 0x87, 0xc5, 0x20, 0x0e, 0x70, 0x0f, 0x62, 0x86, 0xc6, 0x11,
+	0x0e, 0x70, 0x1f, 0x70, 0x87, 0xc8, 0x60, 0x87, 0xc8, 0x63, 0x88, 0xce,
+	0x8a, 0xcb, 0x8c, 0xc9, 0x90, 0xc3, 0x89
 };
 
 const char gps_icon[] PROGMEM = {
-	0x8c, 0x03, 0x90, 0x1f, 0x90, 0x7f, 0x94, 0x0f, 0x8c, 0x67, 0x03, 0x1f,
-	0x78, 0x1d, 0x7c, 0x07, 0x5e, 0x73, 0x7d, 0x40, 0x19, 0x07, 0x22, 0x5c,
-	0x39, 0x40, 0x47, 0x7d, 0x07, 0x7f, 0x6c, 0x3f, 0x7e, 0x03, 0x70, 0x07,
-	0x1c, 0x00, 0x3f, 0x60, 0x04, 0x70, 0x07, 0x72, 0x00, 0x7f, 0x10, 0x06,
-	0x78, 0x0f, 0x71, 0x00, 0xc7, 0x40, 0x03, 0x78, 0x1f, 0x18, 0x40, 0xc9,
-	0x18, 0x00, 0xce, 0x8a, 0xcb, 0x8c, 0xc9, 0x90, 0x0f, 0x00
+	0x8c, 0xc1, 0x95, 0xc4, 0x92, 0xc6, 0x94, 0xc3, 0x8f, 0x67, 0x03, 0x1f,
+	0x78, 0x1d, 0x7c, 0x07, 0x5e, 0x73, 0x7d, 0x85, 0x33, 0x0e, 0x44, 0x38,
+	0x73, 0x85, 0x1e, 0x76, 0x1f, 0x7c, 0x33, 0xc7, 0x81, 0xc7, 0x88, 0xc5,
+	0x40, 0x03, 0x70, 0x07, 0x4c, 0x87, 0xc5, 0x20, 0x0e, 0x70, 0x0f, 0x62,
+	0x86, 0xc6, 0x11, 0x0e, 0x70, 0x1f, 0x70, 0x87, 0xc8, 0x60, 0x87, 0xc8,
+	0x63, 0x88, 0xce, 0x8a, 0xcb, 0x8c, 0xc9, 0x90, 0xc3, 0x89
 };
 
-#define LAST_SAMPLES_COUNT  5
-int32_t dP_dt;
-
 // Null character as string separator
 const char str_A[] PROGMEM = "Settled fine\0";
 const char str_B[] PROGMEM = "Fine weather\0";
@@ -181,16 +247,6 @@ PGM_P const forecast[] PROGMEM = {
 	str_A, str_B, str_C, str_D, str_E, str_F, str_G, str_H, str_I, str_J, str_K, str_L, str_M, 
 	str_N, str_O, str_P, str_Q, str_R, str_S, str_T, str_U, str_V, str_W, str_X, str_Y, str_Z
 };
-const char rising[] PROGMEM = {
-	'A', 'B', 'B', 'C', 'F', 'G', 'I', 'J', 'L', 'M', 'M', 'Q', 'T', 'Y'
-};
-const char falling[] PROGMEM = {
-	'B', 'D', 'H', 'O', 'R', 'U', 'V', 'X', 'X', 'Z'
-};
-const char steady[] PROGMEM = {
-	'A', 'B', 'B', 'B', 'E', 'K', 'N', 'N', 'P', 'P', 'S', 'W', 'W', 'X', 'X', 'X', 'Z'
-};
-
 #define map(x,in_min,in_max,out_min,out_max) (((x)-(in_min))*((out_max)-(out_min))/((in_max)-(in_min))+(out_min))
 #define min(a,b) ((a)<(b)?(a):(b))
 #define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
@@ -204,8 +260,7 @@ ISR(TIMER2_COMPA_vect) {
 	if (++msec == 1000) {
 		msec = 0;
 		system_tick();
-		for (uint8_t i = 0; i < SENSOR_COUNT; i++)
-			remote[i].age++;
+		uptime++;
 		action.blink = !action.blink;
 		action.update_screen = true;
 		if (++sec == 60) {
@@ -228,6 +283,13 @@ static void timer2_init() {
 	TIMSK2 = _BV(OCIE2A);
 }
 
+// Read millisecond counter, which the timer interrupt may change between its two bytes
+static uint16_t now_ms(void) {
+	uint16_t t;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) t = millis;
+	return t;
+}
+
 // Initialize LED PWM
 static void timer0_init(void) {
 	TCCR0A = _BV(COM0B1) | _BV(WGM01) | _BV(WGM00); /* Enable non inverting 8-Bit PWM */
@@ -252,17 +314,6 @@ static uint8_t read_adc(uint8_t ch) {
 	return ADCH;
 }
 
-// Daylight Saving function for the European Union
-// From http://savannah.nongnu.org/bugs/?44327
-static int eu_dst(const time_t *timer, int32_t *z)
-{
-	uint32_t t = *timer;
-	if ((uint8_t)(t >> 24) >= 194) t -= 3029443200U;
-	t = (t + 655513200) / 604800 * 28;
-	if ((uint16_t)(t % 1461) < 856) return 3600;
-	else return 0;
-}
-
 // Convert (scaled) integer to (zero filled) string
 static char *itostr(int16_t num, char *str, uint8_t decimal, uint8_t padding) {
 	uint8_t i = 0;
@@ -282,136 +333,47 @@ static char *itostr(int16_t num, char *str, uint8_t decimal, uint8_t padding) {
 	return strrev(str);
 }
 
-// Based on https://www.nxp.com/docs/en/application-note/AN3914.pdf
-// Pressure in Pa -->  forecast done by calculating Pa/h
-static void sample(uint32_t pressure) {
-	static uint32_t lastPressureSamples[LAST_SAMPLES_COUNT];
-	static uint8_t minuteCount = 0;
-	static bool firstPass = true;
-	static uint32_t pressureAvg;
-	static uint32_t pressureAvg2;
-
-	// Calculate the average of the last n minutes.
-	uint8_t index = minuteCount % LAST_SAMPLES_COUNT;
-	lastPressureSamples[index] = pressure;
-	uint32_t lastPressureAvg = 0;
-	for (uint8_t i = 0; i < LAST_SAMPLES_COUNT; i++) {
-		lastPressureAvg += lastPressureSamples[i];
-	}
-	lastPressureAvg /= LAST_SAMPLES_COUNT;
-	
-	minuteCount++;
-	if (minuteCount > 180) {
-		minuteCount = 6;
-	}
-	if (minuteCount == 5) {
-		pressureAvg = lastPressureAvg;
-	} else if (minuteCount == 35) {
-		int32_t change = (lastPressureAvg - pressureAvg);
-		if (firstPass) { // first time initial 3 hour
-			dP_dt = change * 2; // note this is for t = 0.5hour
-		} else {
-			dP_dt = (change * 2) / 3; // divide by 1.5 as this is the difference in time from 0 value.
-		}
-	} else if (minuteCount == 60) {
-		int32_t change = (lastPressureAvg - pressureAvg);
-		if (firstPass) { //first time initial 3 hour
-			dP_dt = change; //note this is for t = 1 hour
-		} else {
-			dP_dt = change / 2; //divide by 2 as this is the difference in time from 0 value
-		}
-	} else if (minuteCount == 95) {
-		int32_t change = (lastPressureAvg - pressureAvg);
-		if (firstPass) { // first time initial 3 hour
-			dP_dt = (change * 2) / 3; // note this is for t = 1.5 hour
-		} else {
-			dP_dt = (change * 2) / 5; // divide by 2.5 as this is the difference in time from 0 value
-		}
-	} else if (minuteCount == 120) {
-		pressureAvg2 = lastPressureAvg; // store for later use.
-		int32_t change = (lastPressureAvg - pressureAvg);
-		if (firstPass) { // first time initial 3 hour
-			dP_dt = change / 2; // note this is for t = 2 hour
-		} else {
-			dP_dt = change / 3; // divide by 3 as this is the difference in time from 0 value
-		}
-	} else if (minuteCount == 155) {
-		int32_t change = (lastPressureAvg - pressureAvg);
-		if (firstPass) { // first time initial 3 hour
-			dP_dt = (change * 2) / 5; // note this is for t = 2.5 hour
-		} else {
-			dP_dt = (change * 2) / 7; // divide by 3.5 as this is the difference in time from 0 value
-		}
-	} else if (minuteCount == 180) {
-		int32_t change = (lastPressureAvg - pressureAvg);
-		if (firstPass) { // first time initial 3 hour
-			dP_dt = change / 3; // note this is for t = 3 hour
-		} else {
-			dP_dt = change / 4; // divide by 4 as this is the difference in time from 0 value
-		}
-		pressureAvg = pressureAvg2; // Equating the pressure at 0 to the pressure at 2 hour after 3 hours have past.
-		firstPass = false; // flag to let you know that this is on the past 3 hour mark.
-	}
+// draw a scaled integer at cursor
+static void drawScaled(int16_t value) {
+	ili9341_puts(itostr(value, buffer, 1, 2));
 }
 
-// Simple implementation of Zambretti forecaster algorithm
-static char zambretti(int32_t pressure, int8_t month) {
-	if (dP_dt > 25) {
-		// rising pressure
-		if (north == (month >= 4 && month <= 9)) pressure += 320;
-		int8_t index = (103140 - pressure) / 574;
-		if (index < 0) index = 0;
-		if (index > 13) index = 13;
-		return pgm_read_byte(&rising[index]);
-	} else if (dP_dt < -25) {
-		// falling pressure
-		if (north == (month >= 4 && month <= 9)) pressure -= 320;
-		int8_t index = (102995 - pressure) / 652;
-		if (index < 0) index = 0;
-		if (index > 9) index = 9;
-		return pgm_read_byte(&falling[index]);
+// draw a string right aligned in an area. when old string is set and ends at
+// the same position, only the characters that differ are sent to the display
+static void drawRight(uint16_t x, uint16_t y, uint16_t w, const char *str, const char *old) {
+	uint16_t pos = x + w - ili9341_strWidth(str);
+	ili9341_setCursor(pos, y);
+	if (old && x + w - ili9341_strWidth(old) == pos) {
+		ili9341_putsDiff(old, str);
 	} else {
-		// steady
-		int8_t index = (103081 - pressure) / 432;
-		if (index < 0) index = 0;
-		if (index > 16) index = 16;
-		return pgm_read_byte(&steady[index]);
+		ili9341_clearTextArea(x);
+		ili9341_puts(str);
 	}
 }
 
-// draw a scaled integer at cursor
-static void drawScaled(int16_t value) {
-	ili9341_puts(itostr(value, buffer, 1, 2));
+// draw a scaled integer right aligned in an area. old is NOT_SHOWN or the value drawn before
+static void drawScaledRight(uint16_t x, uint16_t y, uint16_t w, int16_t value, int16_t old) {
+	char prev[8];
+	itostr(value, buffer, 1, 2);
+	drawRight(x, y, w, buffer, (old == NOT_SHOWN) ? NULL : itostr(old, prev, 1, 2));
 }
 
-// draw a scaled integer right aligned in an area
-static void drawScaledRight(uint16_t x, uint16_t y, uint16_t w, int16_t value) {
-	itostr(value, buffer, 1, 2);
-	ili9341_setCursor(x + w - ili9341_strWidth(buffer), y);
-	ili9341_clearTextArea(x);
-	ili9341_puts(buffer);
+// format pressure converted to selected unit
+static char *formatPressure(int16_t value, char *str) {
+	uint8_t dec = units_decimals(b_pressure.value);
+	return itostr(value, str, dec, dec + 1);
 }
 
-// convert and draw scaled pressure. align right when w is set
-static void drawPressure(uint16_t x, uint16_t y, uint16_t w, int32_t value) {
-	uint8_t dec = 1, pad = 2;
-	int16_t val = value / 10;
-	if (b_pressure.value == PRESSURE_MMHG) {
-		val = value / 13.3322;
-	}
-	if (b_pressure.value == PRESSURE_INHG) {
-		dec = 2; pad = 3;
-		val = value / 33.8639;
-	}
-	if (b_pressure.value == PRESSURE_PSI) {
-		dec = 2; pad = 3;
-		val = value / 68.9655;
+// draw converted pressure. align right when w is set, old is NOT_SHOWN or the value drawn before
+static void drawPressure(uint16_t x, uint16_t y, uint16_t w, int16_t value, int16_t old) {
+	char prev[8];
+	formatPressure(value, buffer);
+	if (w) {
+		drawRight(x, y, w, buffer, (old == NOT_SHOWN) ? NULL : formatPressure(old, prev));
+	} else {
+		ili9341_setCursor(x, y);
+		ili9341_puts(buffer);
 	}
-	itostr(val, buffer, dec, pad);
-	uint16_t pos = (w) ? w - ili9341_strWidth(buffer) : 0;
-	ili9341_setCursor(x + pos, y);
-	if (w) ili9341_clearTextArea(x);
-	ili9341_puts(buffer);
 }
 
 // draw integer at cursor
@@ -419,6 +381,16 @@ static void drawInt(int16_t value) {
 	ili9341_puts(itostr(value, buffer, 0, 0));
 }
 
+// draw UTC offset in minutes as hours and optional minutes
+static void drawOffset(int16_t offset) {
+	ili9341_write((offset < 0) ? '-' : '+');
+	drawInt(abs(offset) / 60);
+	if (offset % 60) {
+		ili9341_write(':');
+		ili9341_puts(itostr(abs(offset) % 60, buffer, 0, 2));
+	}
+}
+
 // draw a code page 437 ascii character
 static void drawSymbol(uint8_t c) {
 	uint16_t x, y;
@@ -427,36 +399,116 @@ static void drawSymbol(uint8_t c) {
 	ili9341_setFont(cp437font8x8);
 	ili9341_write(c);
 	ili9341_fillrect(x, y+8, 8, h-8, bgcolor);
-	ili9341_setFont(Arial_bold_14);
+	ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
+}
+
+// calculate minimum and maximum of last 24 hours from the periods
+static void sumDay(extremes_t *s) {
+	s->day = s->hist[0];
+	for (uint8_t j = 1; j < max_period; j++) {
+		if (s->hist[j].max_humid > s->day.max_humid) s->day.max_humid = s->hist[j].max_humid;
+		if (s->hist[j].min_humid < s->day.min_humid) s->day.min_humid = s->hist[j].min_humid;
+		if (s->hist[j].max_temp > s->day.max_temp) s->day.max_temp = s->hist[j].max_temp;
+		if (s->hist[j].min_temp < s->day.min_temp) s->day.min_temp = s->hist[j].min_temp;
+	}
+}
+
+// widen minimum and maximum values with reading
+static void widen(history_t *h, int16_t temp, uint16_t humid) {
+	if (humid > h->max_humid) h->max_humid = humid;
+	if (humid < h->min_humid) h->min_humid = humid;
+	if (temp > h->max_temp) h->max_temp = temp;
+	if (temp < h->min_temp) h->min_temp = temp;
+}
+
+// add reading to current period and last 24 hours
+static void addReading(extremes_t *s, int16_t temp, uint16_t humid) {
+	widen(&s->hist[period], temp, humid);
+	widen(&s->day, temp, humid);
+}
+
+// widen range with values
+static void widenRange(range_t *range, int16_t temp, uint16_t humid) {
+	if (temp > range->h_temp) range->h_temp = temp;
+	if (temp < range->l_temp) range->l_temp = temp;
+	if (humid > range->h_humid) range->h_humid = humid;
+	if (humid < range->l_humid) range->l_humid = humid;
+}
+
+// seconds since last packet of sensor
+static uint16_t sensorAge(uint8_t i) {
+	uint16_t now;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) now = uptime;
+	return now - remote_seen[i];
+}
+
+// read name from EEPROM if set or use default value
+static void readName(uint8_t i, char *name) {
+	eeprom_read_block(name, &nv.names[i], sizeof(nv.names[i]));
+	if (name[0] == 0xFF) {
+		name[0] = '#';
+		name[1] = i<0xA ? '0'+i : 'A'+i-0xA;
+		name[2] = 0;
+	}
+}
+
+// calculate range of enabled remote sensors
+static void rangeRemote(void) {
+	remote_range = (range_t){INT16_MIN, INT16_MAX, 0, UINT16_MAX};
+	for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+		if (remote_enabled & SENSOR_BIT(i)) widenRange(&remote_range, remote_reading[i].temp, remote_reading[i].humid);
+	}
 }
 
 // initialize array for current period
 static void init_period(void) {
 	for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
-		remote[i].hist[period].max_humid = 0;
-		remote[i].hist[period].max_temp = -400;
-		remote[i].hist[period].min_humid = 999;
-		remote[i].hist[period].min_temp = 1250;
+		remote_extremes[i].hist[period].max_humid = 0;
+		remote_extremes[i].hist[period].max_temp = -400;
+		remote_extremes[i].hist[period].min_humid = 999;
+		remote_extremes[i].hist[period].min_temp = 1250;
 	}
 	local.hist[period].max_humid = 0;
 	local.hist[period].max_temp = -4000;
 	local.hist[period].min_humid = 1000;
 	local.hist[period].min_temp = 8500;
+	for (uint8_t i = 0; i < SENSOR_COUNT; i++)
+		sumDay(&remote_extremes[i]);
+	sumDay(&local);
 }
 
-// format and draw time
-static void drawTime(const time_t *timer) {
-	struct tm *timeptr;
-	
-	timeptr = localtime(timer);
-	itostr(timeptr->tm_hour, buffer, 0, 2);
+// format and draw local hour, minute and second
+static void drawTime(const uint8_t *hms) {
+	itostr(hms[0], buffer, 0, 2);
 	buffer[2] = ':';
-	itostr(timeptr->tm_min, &buffer[3], 0, 2);
+	itostr(hms[1], &buffer[3], 0, 2);
 	buffer[5] = ':';
-	itostr(timeptr->tm_sec, &buffer[6], 0, 2);
+	itostr(hms[2], &buffer[6], 0, 2);
 	ili9341_puts(buffer);
 }
 
+// convert time to local hour, minute and second
+static void splitTime(const time_t *timer, uint8_t *hms) {
+	struct tm *timeptr = localtime(timer);
+	hms[0] = timeptr->tm_hour;
+	hms[1] = timeptr->tm_min;
+	hms[2] = timeptr->tm_sec;
+}
+
+// calculate sun times once per day, solar_noon() uses the same day
+static void updateSun(time_t now) {
+	uint16_t day = now / ONE_DAY;
+	if (day == sun.day) return;
+	sun.day = day;
+	time_t noon = solar_noon(&now);
+	int32_t half = daylight_seconds(&now) / 2;
+	sun.sunset = noon + half;
+	sun.sunrise = noon - half;
+	sun.month = localtime(&noon)->tm_mon;
+	splitTime(&sun.sunrise, sun.rise);
+	splitTime(&sun.sunset, sun.set);
+}
+
 // draw degrees symbol with temperature unit and optional space
 static void drawTempUnit(bool space) {
 	drawSymbol(9);
@@ -468,16 +520,14 @@ static void drawTempUnit(bool space) {
 static void drawScreen(void) {
 	view = SCREEN;
 	ili9341_fillScreen(bgcolor);
-	ili9341_setFont(Arial_bold_14);
+	ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
 	ili9341_drawRect(0,0,210,224,ILI9341_GRAY);
 	ili9341_setCursor(1,0);
 	ili9341_setTextColor(fgcolor, ILI9341_GRAY);
-	ili9341_puts_p(PSTR("Remote stations"));
-	ili9341_clearTextArea(209);
+	ili9341_putsClear_p(PSTR("Remote stations"), 209);
 	ili9341_drawRect(210,0,110,224,ILI9341_GRAY);
 	ili9341_setCursor(211,0);
-	ili9341_puts_p(PSTR("Base station"));
-	ili9341_clearTextArea(319);
+	ili9341_putsClear_p(PSTR("Base station"), 319);
 	ili9341_setTextColor(fgcolor, bgcolor);
 	ili9341_setCursor(295,15);
 	drawTempUnit(false);
@@ -490,6 +540,11 @@ static void drawScreen(void) {
 	}
 	ili9341_puts_p((b_pressure.value == 2) ? PSTR("Hg") : (b_pressure.value == 3) ? PSTR("\"Hg") : (b_pressure.value == 4) ? PSTR("psi") : PSTR("hPa"));
 	refresh = true;
+	// everything needs to be drawn again
+	shown_local.id = 0xFF;
+	for (uint8_t i = 0; i < SHOWN_COUNT; i++)
+		shown_remote[i].id = 0xFF;
+	shown_time = 0;
 }
 
 // returns true when dark mode is enabled or disabled
@@ -512,7 +567,7 @@ static bool changeMode(void) {
 
 // convert scaled temperature in DegC to Fahrenheit
 static int16_t convertTemp(int16_t temp) {
-	return (b_degrees.value == DEG_CELSIUS) ? temp : temp * 36 / 20 + 320;
+	return units_temp(temp, b_degrees.value);
 }
 
 // convert to spectrum color from 0=green to 63=red
@@ -531,58 +586,83 @@ static uint16_t blue_red(uint8_t value) {
 	return (red << 11) + blue;
 }
 
-// convert station pressure to sea level pressure
-// Babinet's formula is accurate up to 1000 meters and within 1% to considerably greater heights.
-static int32_t convertSeaLevel(int32_t pressure, int8_t temperature) {
-	// altitude in whole meters and temperature in whole degrees (not scaled)
-	return -pressure * (altitude + 16000 + 64 * temperature) / (altitude - 16000 - 64 * temperature);
-}
+enum {STEP_READ, STEP_FORECAST, STEP_LOCAL, STEP_CLOCK, STEP_REMOTE, STEP_DONE};
 
-// update main screen
-static void updateScreen(void) {
-	int16_t temp = 0;
+// state of main screen update that is drawn in slices
+struct {
+	uint8_t step;		// region to draw next, STEP_READ when idle
+	uint8_t sensor, row;	// next remote sensor and its row
+	uint16_t y;		// top of next remote row
+	bool clearToBottom;
+	uint16_t time;		// ms spent drawing
+	int16_t temp;
 	uint32_t pres, humid;
-	history_t local_day, remote_day;
+	int16_t pres_shown;	// in selected unit
+	range_t range;		// of base station and remote sensors
+	uint8_t version;	// incremented when range changes
 	time_t now;
+} render;
+
+// update main screen by drawing one region per call, returns true until done
+static bool updateScreen(void) {
 	PGM_P ptr;
-	
-	// every 6 hours
-	if (action.advance_period) {
-		action.advance_period = false;
-		period = (period + 1) % 4;
-		if (max_period < 4) max_period++;
-		init_period();
-	}
-	// get base station sensor readings
-	do {
-		bme280_get_sensor_data(&temp, &pres, &humid);
-		humid = humid * 10 / 1024;
-	} while (temp < -4000);
-	// calculate minimum and maximum values
-	if (humid > local.hist[period].max_humid) local.hist[period].max_humid = humid;
-	if (humid < local.hist[period].min_humid) local.hist[period].min_humid = humid;
-	if (temp > local.hist[period].max_temp) local.hist[period].max_temp = temp;
-	if (temp < local.hist[period].min_temp) local.hist[period].min_temp = temp;
-	memcpy(&local_day, &local.hist[0], sizeof(history_t));
-	for (uint8_t j = 1; j < max_period; j++) {
-		if (local.hist[j].max_humid > local_day.max_humid) local_day.max_humid = local.hist[j].max_humid;
-		if (local.hist[j].min_humid < local_day.min_humid) local_day.min_humid = local.hist[j].min_humid;
-		if (local.hist[j].max_temp > local_day.max_temp) local_day.max_temp = local.hist[j].max_temp;
-		if (local.hist[j].min_temp < local_day.min_temp) local_day.min_temp = local.hist[j].min_temp;
-	}
-	// forecast
-	if (action.take_sample) {
-		action.take_sample = false;
-		sample(pres);
-		refresh = true;
-	}
-	time(&now);
-	if (refresh) {
+	int16_t temp = render.temp;
+	uint32_t pres = render.pres, humid = render.humid;
+	uint16_t temp_color, humid_color;
+	bool same;
+
+	switch (render.step) {
+	case STEP_READ:
+		// every 6 hours
+		if (action.advance_period) {
+			action.advance_period = false;
+			period = (period + 1) % 4;
+			if (max_period < 4) max_period++;
+			init_period();
+		}
+		// get base station sensor readings
+		PROFILE_START(bme280_start);
+		do {
+			bme280_get_sensor_data(&temp, &pres, &humid);
+			humid = humid * 10 / 1024;
+		} while (temp < -4000);
+		PROFILE_END(PROFILE_BME280, bme280_start);
+		render.temp = temp;
+		render.pres = pres;
+		render.pres_shown = units_pressure(pres, b_pressure.value);
+		render.humid = humid;
+		addReading(&local, temp, humid);
+		// forecast
+		if (action.take_sample) {
+			action.take_sample = false;
+			forecast_sample(pres);
+			refresh = true;
+		}
+		time(&render.now);
+		// global highest and lowest values
+		range_t range = remote_range;
+		widenRange(&range, temp / 10, humid);
+		if (memcmp(&range, &render.range, sizeof(range_t))) {
+			render.range = range;
+			render.version++;
+		}
+		render.sensor = render.row = 0;
+		render.y = 15;
+		render.clearToBottom = false;
+		render.time = 0;
+		render.step = STEP_FORECAST;
+		return true;
+	case STEP_FORECAST:
+		render.step = STEP_LOCAL;
+		if (!refresh) return true;
 		refresh = false;
+		PROFILE_START(forecast_start);
+		// determine day/night mode
+		updateSun(render.now);
+		is_day = (render.now >= sun.sunrise && render.now < sun.sunset);
+		if (changeMode()) drawScreen();
 		// show forecast
-		struct tm *timeptr;
-		timeptr = localtime(&now);
-		char z = zambretti(convertSeaLevel(pres, temp / 100), timeptr->tm_mon);
+		char z = forecast_zambretti(forecast_seaLevel(pres, temp / 100, altitude), sun.month, north);
 		if (z < 'C')
 			ptr = (is_day) ? clear_icon : nt_clear_icon;
 		else if (z < 'E')
@@ -597,199 +677,275 @@ static void updateScreen(void) {
 		memcpy_P(&ptr, &forecast[z - 'A'], sizeof(PGM_P));
 		// draw first line
 		ili9341_setCursor(211,144);
-		ili9341_puts_p(ptr);
-		ili9341_clearTextArea(319);
+		ili9341_putsClear_p(ptr, 319);
 		// draw second line
 		ili9341_setCursor(211,159);
 		const char *split = strchr_P(ptr, 0);
-		ili9341_puts_p(++split);
-		ili9341_clearTextArea(319);
+		ili9341_putsClear_p(++split, 319);
 		// show pressure trend
-		drawPressure(211,204,0,dP_dt);
-		ili9341_puts_p((b_pressure.value == 2) ? PSTR(" mmHg/hr") : (b_pressure.value == 3) ? PSTR(" \"Hg/hr") : (b_pressure.value == 4) ? PSTR(" psi/hr") : PSTR(" hPa/hr"));
-		ili9341_clearTextArea(319);
-		// determine day/night mode
-		time_t noon = solar_noon(&now);
-		int32_t half = daylight_seconds(&now) / 2;
-		time_t sunset = noon + half;
-		time_t sunrise = noon - half;
-		is_day = (now >= sunrise && now < sunset);
-		if (changeMode()) drawScreen();
+		drawPressure(211,204,0,units_pressure(forecast_trend, b_pressure.value),NOT_SHOWN);
+		ili9341_putsClear_p((b_pressure.value == 2) ? PSTR(" mmHg/hr") : (b_pressure.value == 3) ? PSTR(" \"Hg/hr") : (b_pressure.value == 4) ? PSTR(" psi/hr") : PSTR(" hPa/hr"), 319);
 		// show sun rise/set time
 		ili9341_setCursor(193,225);
 		drawSymbol(15);
 		if (is_day) {
 			drawSymbol(25);
-			drawTime(&sunset);
+			drawTime(sun.set);
 		} else {
 			drawSymbol(24);
-			drawTime(&sunrise);
+			drawTime(sun.rise);
 		}
 		ili9341_clearTextArea(265);
-	}
-	// calculate global highest and lowest values
-	int16_t h_temp = temp / 10, l_temp = temp / 10;
-	uint16_t h_humid = humid, l_humid = humid;
-	for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
-		if (remote[i].enabled) {
-			if (remote[i].temp > h_temp) h_temp = remote[i].temp;
-			if (remote[i].temp < l_temp) l_temp = remote[i].temp;
-			if (remote[i].humid > h_humid) h_humid = remote[i].humid;
-			if (remote[i].humid < l_humid) l_humid = remote[i].humid;
-		}
-	}
-	// show base station sensor readings
-	ili9341_setFont(lcdnums14x24);
-	uint16_t scale = green_red(map(temp/10,l_temp,h_temp,0,63));
-	ili9341_setTextColor(b_rainbow.value ? scale : ILI9341_RED,bgcolor);
-	drawScaledRight(211,15,84,convertTemp(temp/10));
-	scale = blue_red(map(humid,l_humid,h_humid,0,63));
-	ili9341_setTextColor(b_rainbow.value ? scale : ILI9341_BLUE,bgcolor);
-	drawScaledRight(211,40,84,humid);
-	ili9341_setTextColor(fgcolor,bgcolor);
-	drawPressure(211,65,84,pres);
-	ili9341_setFont(Arial_bold_14);
-	// show minimum
-	ili9341_setCursor(211,174);
-	drawSymbol(25);
-	drawScaled(convertTemp(local_day.min_temp/10));
-	drawTempUnit(true);
-	drawScaled(local_day.min_humid);
-	ili9341_write('%');
-	ili9341_clearTextArea(319);
-	// show maximum
-	ili9341_setCursor(211,190);
-	drawSymbol(24);
-	drawScaled(convertTemp(local_day.max_temp/10));
-	drawTempUnit(true);
-	drawScaled(local_day.max_humid);
-	ili9341_write('%');
-	ili9341_clearTextArea(319);
-	// show time and date
-	ili9341_setCursor(1,225);
-	ctime_r(&now, buffer);
-	ili9341_puts(buffer);
-	ili9341_clearTextArea(192);
-	// show remote sensor readings
-	uint16_t y = 15;
-	bool clearToBottom = false;
-	for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
-		if (!remote[i].enabled) continue;
-		if (remote[i].age > 900) {
-			remote[i].enabled = false;
-			clearToBottom = true;
-			continue;
-		}
-		// calculate minimum and maximum values
-		if (remote[i].humid > remote[i].hist[period].max_humid) remote[i].hist[period].max_humid = remote[i].humid;
-		if (remote[i].humid < remote[i].hist[period].min_humid) remote[i].hist[period].min_humid = remote[i].humid;
-		if (remote[i].temp > remote[i].hist[period].max_temp) remote[i].hist[period].max_temp = remote[i].temp;
-		if (remote[i].temp < remote[i].hist[period].min_temp) remote[i].hist[period].min_temp = remote[i].temp;
-		memcpy(&remote_day, &remote[i].hist[0], sizeof(history_t));
-		for (uint8_t j = 1; j < max_period; j++) {
-			if (remote[i].hist[j].max_humid > remote_day.max_humid) remote_day.max_humid = remote[i].hist[j].max_humid;
-			if (remote[i].hist[j].min_humid < remote_day.min_humid) remote_day.min_humid = remote[i].hist[j].min_humid;
-			if (remote[i].hist[j].max_temp > remote_day.max_temp) remote_day.max_temp = remote[i].hist[j].max_temp;
-			if (remote[i].hist[j].min_temp < remote_day.min_temp) remote_day.min_temp = remote[i].hist[j].min_temp;
-		}
-		// show unit name
-		ili9341_fillCircle(6,y+22,5,green_red(min(remote[i].age, 63)));
-		ili9341_setFont(Arial_bold_14);
-		ili9341_setCursor(1,y);
-		ili9341_puts(remote[i].name);
-		if (remote[i].unit.result) {
-			// show status
-			ili9341_puts_p((remote[i].unit.result == NO_RESPONSE) ? PSTR(" No response") : PSTR(" CRC error"));
-			ili9341_clearTextArea(209);
-			ili9341_fillrect(12,y+15,197,16,bgcolor);
-			y += 17;
-		} else {
-			// show current temperature
-			ili9341_clearTextArea(29);
-			ili9341_setFont(lcdnums12x16);
-			scale = green_red(map(remote[i].temp,l_temp,h_temp,0,63));
-			ili9341_setTextColor(b_rainbow.value ? scale : ILI9341_RED,bgcolor);
-			drawScaledRight(30,y,60,convertTemp(remote[i].temp));
-			ili9341_setTextColor(fgcolor,bgcolor);
-			drawTempUnit(false);
-			ili9341_setCursor(109,y);
-			// show minimum
+		PROFILE_END(PROFILE_FORECAST, forecast_start);
+		return true;
+	case STEP_LOCAL:
+		// show base station sensor readings
+		same = shown_local.id != 0xFF;
+		ili9341_setFont(lcdnums14x24);
+		// colors only change with value or range
+		if (same && shown_local.version == render.version && shown_local.temp == temp/10)
+			temp_color = shown_local.temp_color;
+		else
+			temp_color = b_rainbow.value ? green_red(map(temp/10,render.range.l_temp,render.range.h_temp,0,63)) : ILI9341_RED;
+		ili9341_setTextColor(temp_color,bgcolor);
+		drawScaledRight(211,15,84,convertTemp(temp/10),(same && shown_local.temp_color == temp_color) ? convertTemp(shown_local.temp) : NOT_SHOWN);
+		if (same && shown_local.version == render.version && shown_local.humid == humid)
+			humid_color = shown_local.humid_color;
+		else
+			humid_color = b_rainbow.value ? blue_red(map(humid,render.range.l_humid,render.range.h_humid,0,63)) : ILI9341_BLUE;
+		ili9341_setTextColor(humid_color,bgcolor);
+		drawScaledRight(211,40,84,humid,(same && shown_local.humid_color == humid_color) ? shown_local.humid : NOT_SHOWN);
+		ili9341_setTextColor(fgcolor,bgcolor);
+		drawPressure(211,65,84,render.pres_shown,(same) ? shown_pres : NOT_SHOWN);
+		ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
+		// show minimum
+		if (!same || shown_local.day.min_temp != local.day.min_temp || shown_local.day.min_humid != local.day.min_humid) {
+			ili9341_setCursor(211,174);
 			drawSymbol(25);
-			drawScaled(convertTemp(remote_day.min_temp));
+			drawScaled(convertTemp(local.day.min_temp/10));
 			drawTempUnit(true);
-			if (remote[i].unit.type != DS18B20) {
-				drawScaled(remote_day.min_humid);
-				ili9341_write('%');
-			}
-			ili9341_clearTextArea(209);
-			// show maximum
-			ili9341_setCursor(109,y+15);
+			drawScaled(local.day.min_humid);
+			ili9341_write('%');
+			ili9341_clearTextArea(319);
+		}
+		// show maximum
+		if (!same || shown_local.day.max_temp != local.day.max_temp || shown_local.day.max_humid != local.day.max_humid) {
+			ili9341_setCursor(211,190);
 			drawSymbol(24);
-			drawScaled(convertTemp(remote_day.max_temp));
+			drawScaled(convertTemp(local.day.max_temp/10));
 			drawTempUnit(true);
-			if (remote[i].unit.type != DS18B20) {
-				drawScaled(remote_day.max_humid);
-				ili9341_write('%');
+			drawScaled(local.day.max_humid);
+			ili9341_write('%');
+			ili9341_clearTextArea(319);
+		}
+		shown_local.id = 0;
+		shown_local.temp = temp/10;
+		shown_local.humid = humid;
+		shown_local.temp_color = temp_color;
+		shown_local.humid_color = humid_color;
+		shown_local.version = render.version;
+		shown_local.day = local.day;
+		shown_pres = render.pres_shown;
+		render.step = STEP_CLOCK;
+		return true;
+	case STEP_CLOCK:
+		// show time and date
+		ili9341_setCursor(1,225);
+		if (shown_time) {
+			// the calendar still holds the shown time, so this is not converted again
+			char prev[sizeof(buffer)];
+			asctime_r(calendar_local(shown_time), prev);
+			asctime_r(calendar_local(render.now), buffer);
+			ili9341_putsDiff(prev, buffer);
+		} else {
+			asctime_r(calendar_local(render.now), buffer);
+			ili9341_puts(buffer);
+		}
+		ili9341_clearTextArea(192);
+		shown_time = render.now;
+		render.step = STEP_REMOTE;
+		return true;
+	case STEP_REMOTE:
+		// show one remote sensor per call
+		while (render.sensor < SENSOR_COUNT) {
+			uint8_t i = render.sensor++;
+			uint16_t y = render.y;
+			shown_t overflow;
+			if (!(remote_enabled & SENSOR_BIT(i))) continue;
+			uint16_t age = sensorAge(i);
+			if (age > 900) {
+				remote_enabled &= ~SENSOR_BIT(i);
+				render.clearToBottom = true;
+				rangeRemote();
+				continue;
 			}
-			ili9341_clearTextArea(209);
-			y += 17;
-			// show current humidity
-			if (remote[i].unit.type != DS18B20) {
+			PROFILE_START(remote_start);
+			// values drawn before in this row
+			shown_t *s = &overflow;
+			overflow.id = 0xFF;
+			if (render.row < SHOWN_COUNT) s = &shown_remote[render.row++];
+			same = s->id == i && s->y == y && s->unit.raw == remote_unit[i].raw;
+			// colors only change with value or range
+			bool cached = same && s->version == render.version;
+			if (cached && s->temp == remote_reading[i].temp)
+				temp_color = s->temp_color;
+			else
+				temp_color = b_rainbow.value ? green_red(map(remote_reading[i].temp,render.range.l_temp,render.range.h_temp,0,63)) : ILI9341_RED;
+			if (cached && s->humid == remote_reading[i].humid)
+				humid_color = s->humid_color;
+			else
+				humid_color = b_rainbow.value ? blue_red(map(remote_reading[i].humid,render.range.l_humid,render.range.h_humid,0,63)) : ILI9341_BLUE;
+			s->id = i;
+			s->y = y;
+			s->unit = remote_unit[i];
+			// show unit name
+			ili9341_fillCircleBg(6,y+22,5,green_red(min(age, 63)),bgcolor);
+			ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
+			if (!same) {
+				char name[4];
+				readName(i, name);
+				ili9341_setCursor(1,y);
+				ili9341_puts(name);
+			}
+			if (remote_unit[i].result) {
+				// show status
+				if (!same) {
+					ili9341_putsClear_p((remote_unit[i].result == NO_RESPONSE) ? PSTR(" No response") : PSTR(" CRC error"), 209);
+					ili9341_fillrect(12,y+15,197,16,bgcolor);
+				}
+				y += 17;
+			} else {
+				// show current temperature
+				if (!same) ili9341_clearTextArea(29);
 				ili9341_setFont(lcdnums12x16);
-				scale = blue_red(map(remote[i].humid,l_humid,h_humid,0,63));
-				ili9341_setTextColor(b_rainbow.value ? scale : ILI9341_BLUE,bgcolor);
-				drawScaledRight(30,y,60,remote[i].humid);
+				ili9341_setTextColor(temp_color,bgcolor);
+				drawScaledRight(30,y,60,convertTemp(remote_reading[i].temp),(same && s->temp_color == temp_color) ? convertTemp(s->temp) : NOT_SHOWN);
 				ili9341_setTextColor(fgcolor,bgcolor);
-				ili9341_setFont(Arial_bold_14);
-				ili9341_write('%');
-			} else
-				ili9341_fillrect(30,y,68,16,bgcolor);
+				if (!same) drawTempUnit(false);
+				ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
+				// show minimum
+				if (!same || s->day.min_temp != remote_extremes[i].day.min_temp || s->day.min_humid != remote_extremes[i].day.min_humid) {
+					ili9341_setCursor(109,y);
+					drawSymbol(25);
+					drawScaled(convertTemp(remote_extremes[i].day.min_temp));
+					drawTempUnit(true);
+					if (remote_unit[i].type != DS18B20) {
+						drawScaled(remote_extremes[i].day.min_humid);
+						ili9341_write('%');
+					}
+					ili9341_clearTextArea(209);
+				}
+				// show maximum
+				if (!same || s->day.max_temp != remote_extremes[i].day.max_temp || s->day.max_humid != remote_extremes[i].day.max_humid) {
+					ili9341_setCursor(109,y+15);
+					drawSymbol(24);
+					drawScaled(convertTemp(remote_extremes[i].day.max_temp));
+					drawTempUnit(true);
+					if (remote_unit[i].type != DS18B20) {
+						drawScaled(remote_extremes[i].day.max_humid);
+						ili9341_write('%');
+					}
+					ili9341_clearTextArea(209);
+				}
+				y += 17;
+				// show current humidity
+				if (remote_unit[i].type != DS18B20) {
+					ili9341_setFont(lcdnums12x16);
+					ili9341_setTextColor(humid_color,bgcolor);
+					drawScaledRight(30,y,60,remote_reading[i].humid,(same && s->humid_color == humid_color) ? s->humid : NOT_SHOWN);
+					ili9341_setTextColor(fgcolor,bgcolor);
+					ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
+					if (!same) ili9341_write('%');
+				} else if (!same)
+					ili9341_fillrect(30,y,68,16,bgcolor);
+			}
+			s->temp = remote_reading[i].temp;
+			s->humid = remote_reading[i].humid;
+			s->temp_color = temp_color;
+			s->humid_color = humid_color;
+			s->version = render.version;
+			s->day = remote_extremes[i].day;
+			y += 17;
+			render.y = y;
+			PROFILE_END(PROFILE_REMOTE, remote_start);
+			if (y >= 223) break;
+			// show separator
+			if (!same) ili9341_drawhline(0,y,209,ILI9341_GRAY);
+			render.y++;
+			return true;
 		}
-		y += 17;
-		if (y >= 223) break;
-		// show separator
-		ili9341_drawhline(0,y++,209,ILI9341_GRAY);
+		render.step = STEP_DONE;
+		return true;
+	case STEP_DONE:
+		if (render.clearToBottom && render.y < 223) {
+			ili9341_fillrect(1,render.y,208,223-render.y,bgcolor);
+			while (render.row < SHOWN_COUNT)
+				shown_remote[render.row++].id = 0xFF;
+		}
+		ili9341_drawRLEBitmap(294,109,(gps_fix) ? gps_icon : no_gps_icon,24,24,fgcolor, bgcolor);
+		break;
 	}
-	if (clearToBottom && y < 223) ili9341_fillrect(1,y,208,223-y,bgcolor);
+	render.step = STEP_READ;
+	return false;
+}
+
+// width of button with label string/char
+static uint16_t buttonWidth(const char *str, char c) {
+	uint16_t w = ili9341_strWidth_p(str) + 10;
+	if (c) w += ili9341_charWidth(c);
+	return w;
 }
 
 // draw and handle touchscreen button with label string/char. use non zero id for radio button group
 static button_t handleButton(uint16_t x, uint16_t y, const char *str, char c, uint8_t id, button_t button) {
 	uint8_t h = ili9341_fontHeight() + 2;
-	uint16_t w = ili9341_strWidth_p(str) + 10;
-	if (c) w += ili9341_charWidth(c);
+	uint16_t w = 0;
 	uint8_t set = (id) ? id : true;
-	if (ts_x >= x && ts_y >= y && ts_x < x + w && ts_y < y + h) {
+	uint8_t shift = (id) ? 2 * (id - 1) : 0;
+	// only measure label when screen is touched
+	if (ts_x != 0xffff) w = buttonWidth(str, c);
+	if (w && ts_x >= x && ts_y >= y && ts_x < x + w && ts_y < y + h) {
 		button.touch = set;
 	} else if (button.touch == set) {
 		button.touch = false; // button released
 		if (id) button.value = false;
 		button.value ^= set;
 	}
+	// 1 is normal, 2 is value set and 3 is touched
+	uint8_t look = (button.touch == set) ? 3 : (button.value == set) ? 2 : 1;
+	if (!redraw && ((button.shown >> shift) & 3) == look) return button;
+	button.shown = (button.shown & ~(3 << shift)) | (look << shift);
+	if (!w) w = buttonWidth(str, c);
 	// invert color when button touched or has value set
-	if (button.touch == set || button.value == set) {
-		ili9341_setTextColor(bgcolor, (button.touch == set) ? ILI9341_GRAY : fgcolor);
+	if (look > 1) {
+		ili9341_setTextColor(bgcolor, (look == 3) ? ILI9341_GRAY : fgcolor);
 	}
 	ili9341_drawRect(x, y, w, h, fgcolor);
 	ili9341_setCursor(x+6, y+1);
 	ili9341_clearTextArea(x+1); // padding left
-	ili9341_puts_p(str);
-	if (c) ili9341_write(c);
-	ili9341_clearTextArea(x+w-1); // padding right
+	if (c) {
+		char label[] = {c, 0};
+		ili9341_puts_p(str);
+		ili9341_putsClear(label, x+w-1); // padding right
+	} else
+		ili9341_putsClear_p(str, x+w-1); // padding right
 	ili9341_setTextColor(fgcolor,bgcolor);
 	return button;
 }
 
-// draw and handle touchscreen slider
-static int16_t handleSlider(uint16_t x, uint16_t y, int16_t w, int16_t min_val, int16_t max_val, int16_t value) {
+// draw and handle touchscreen slider, shown keeps position and touch state of last drawing
+static int16_t handleSlider(uint16_t x, uint16_t y, int16_t w, int16_t min_val, int16_t max_val, int16_t value, uint16_t *shown) {
 	uint8_t h = ili9341_fontHeight() + 2;
 	uint16_t color = bgcolor;
 	if (ts_x >= x && ts_y >= y && ts_x < x + w && ts_y < y + h) {
 		value = map((int32_t)ts_x, x, x + w, min_val, max_val + 1);
 		color = ILI9341_GRAY;
 	}
-	ili9341_drawRect(x, y, w, h, fgcolor);
 	int16_t pos = map((int32_t)value, min_val, max_val, 0, w-22);
+	uint16_t state = pos | ((color == bgcolor) ? 0 : 0x8000);
+	if (!redraw && *shown == state) return value;
+	*shown = state;
+	ili9341_drawRect(x, y, w, h, fgcolor);
 	ili9341_fillrect(x+1, y+1, pos, h-2, color);
 	ili9341_fillrect(x+pos+1, y+1, 20, h-2, fgcolor);
 	ili9341_fillrect(x+pos+21, y+1, w-pos-22, h-2, color);
@@ -799,6 +955,7 @@ static int16_t handleSlider(uint16_t x, uint16_t y, int16_t w, int16_t min_val,
 // initialize menu screen
 static void drawMenu(void) {
 	view = MENU;
+	redraw_menu = true;
 	ili9341_fillScreen(bgcolor);
 	ili9341_drawRect(0,32,320,168,ILI9341_GRAY);
 }
@@ -806,6 +963,7 @@ static void drawMenu(void) {
 // initialize calibrate screen
 static void drawCalibrate(void) {
 	view = CALIBRATE;
+	redraw_menu = true;
 	ili9341_fillScreen(bgcolor);
 	ili9341_setCursor(0,80);
 	ili9341_puts_p(PSTR("Use pen to touch corners of screen to calibrate"));
@@ -816,36 +974,90 @@ static void drawCalibrate(void) {
 // clear tab
 static void fillTab(void) {
 	ili9341_fillrect(1,33,318,166,bgcolor);
+	redraw = true;
+}
+
+// parse rule of built in time zone
+static void parseZone(uint8_t index, tz_rule_t *rule) {
+	char str[TZ_LENGTH];
+	strcpy_P(str, tz_zone(index));
+	tz_parse(str, rule);
+}
+
+// use time zone rule for local time
+static void setZone(const tz_rule_t *rule) {
+	tz_set(rule);
+	set_zone(rule->offset * 60L);
+	set_dst(tz_dst);
+	calendar_reset();
+	sun.day = NO_DAY;
+}
+
+// true when rule read from EEPROM is not erased or garbled
+static bool validRule(const tz_rule_t *rule) {
+	return rule->start.month <= 12 && rule->end.month <= 12 && rule->offset >= -14 * 60 && rule->offset <= 14 * 60;
+}
+
+// reset settings after the calibration when EEPROM was written by older firmware or not at all
+static void init_nvram(void) {
+	if (eeprom_read_byte(&nv.magic) == NV_MAGIC) return;
+	eeprom_update_byte(&nv.zone, 0xFF);
+	history_clear();
+	// magic last, a power loss in between resets again
+	eeprom_update_byte(&nv.magic, NV_MAGIC);
+}
+
+// read time zone rule from EEPROM, default zone when not set, rule of zone when not valid
+static void init_zone(void) {
+	tz_rule_t rule;
+	zone = eeprom_read_byte(&nv.zone);
+	eeprom_read_block(&rule, &nv.rule, sizeof(rule));
+	if (zone >= TZ_ZONES) {
+		zone = DEFAULT_ZONE;
+		parseZone(zone, &rule);
+	} else if (!validRule(&rule)) {
+		parseZone(zone, &rule);
+	}
+	new_zone = zone;
+	b_dst.value = dst = rule.start.month != 0;
+	setZone(&rule);
 }
 
 // update config tab
 static void updateConfig(void) {
 	static button_t b_plus, b_minus;
+	static uint8_t shown_zone;
 	
 	// draw time zone
 	ili9341_setTextSize(1);
-	ili9341_setCursor(10,37);
-	ili9341_puts_p(PSTR("Time zone"));
-	ili9341_setCursor(10,62);
-	if (new_tz >= 0) ili9341_write('+');
-	drawInt(new_tz);
-	ili9341_clearTextArea(39);
-	ili9341_setCursor(10,91);
-	ili9341_puts_p(PSTR("Temperature"));
-	ili9341_setCursor(10,145);
-	ili9341_puts_p(PSTR("Pressure"));
+	if (redraw) {
+		ili9341_setCursor(10,37);
+		ili9341_puts_p(PSTR("Time zone"));
+		ili9341_setCursor(10,91);
+		ili9341_puts_p(PSTR("Temperature"));
+		ili9341_setCursor(10,145);
+		ili9341_puts_p(PSTR("Pressure"));
+	}
+	if (redraw || new_zone != shown_zone) {
+		tz_rule_t rule;
+		shown_zone = new_zone;
+		parseZone(new_zone, &rule);
+		ili9341_setCursor(10,62);
+		drawOffset(rule.offset);
+		ili9341_clearTextArea(59);
+	}
 	ili9341_setTextSize(2);
-	b_minus = handleButton(40, 54, PSTR("-"), 0, 0, b_minus);
+	b_minus = handleButton(60, 54, PSTR("-"), 0, 0, b_minus);
 	if (b_minus.value) {
-		if (new_tz > -12) new_tz--;
+		if (new_zone > 0) new_zone--;
 		b_minus.value = false;
 	}
-	b_plus = handleButton(59, 54, PSTR("+"), 0, 0, b_plus);
+	b_plus = handleButton(79, 54, PSTR("+"), 0, 0, b_plus);
 	if (b_plus.value) {
-		if (new_tz < 12) new_tz++;
+		if (new_zone < TZ_ZONES - 1) new_zone++;
 		b_plus.value = false;
 	}
-	b_dst = handleButton(95,54,PSTR("DST"),0,0,b_dst);
+	b_dst = handleButton(115,54,PSTR("DST"),0,0,b_dst);
 	b_degrees = handleButton(10,108,PSTR("Celsius"),0,1,b_degrees);
 	b_degrees = handleButton(118,108,PSTR("Fahrenheit"),0,2,b_degrees);
 	b_pressure = handleButton(10,162,PSTR("hPa"),0,1,b_pressure);
@@ -857,21 +1069,28 @@ static void updateConfig(void) {
 // update LCD tab
 static void updateLCD(void) {
 	static button_t b_flip = {.value = true};
+	static uint16_t slider;
+	static uint8_t shown_ocr0b;
 
 	// draw LED percentage
 	ili9341_setTextSize(1);
-	ili9341_setCursor(10,37);
-	ili9341_puts_p(PSTR("Backlight "));
-	drawInt(map((uint16_t)OCR0B, 0, 255, 0, 100));
-	ili9341_write('%');
-	ili9341_clearTextArea(119);
+	if (redraw || OCR0B != shown_ocr0b) {
+		shown_ocr0b = OCR0B;
+		ili9341_setCursor(10,37);
+		ili9341_puts_p(PSTR("Backlight "));
+		drawInt(map((uint16_t)OCR0B, 0, 255, 0, 100));
+		ili9341_write('%');
+		ili9341_clearTextArea(119);
+	}
 	// draw and handle buttons
-	ili9341_setCursor(10,91);
-	ili9341_puts_p(PSTR("Theme"));
-	ili9341_setCursor(10,145);
-	ili9341_puts_p(PSTR("Touchscreen"));
+	if (redraw) {
+		ili9341_setCursor(10,91);
+		ili9341_puts_p(PSTR("Theme"));
+		ili9341_setCursor(10,145);
+		ili9341_puts_p(PSTR("Touchscreen"));
+	}
 	ili9341_setTextSize(2);
-	OCR0B = handleSlider(10,54,200,0,255,OCR0B);
+	OCR0B = handleSlider(10,54,200,0,255,OCR0B,&slider);
 	b_auto_led = handleButton(220,54,PSTR("Auto"),0,0,b_auto_led);
 	b_theme = handleButton(10,108,PSTR("Light"),0,1,b_theme);
 	b_theme = handleButton(95,108,PSTR("Dark"),0,2,b_theme);
@@ -904,12 +1123,17 @@ static void drawPosition(char pos, char neg, int32_t coord) {
 
 // update etc tab
 static void updateEtc(void) {
+	static uint8_t shown_sec;
+
 	ili9341_setTextSize(1);
-	ili9341_setCursor(10,37);
-	ili9341_puts_p(PSTR("Digits"));
-	ili9341_setCursor(10,91);
-	ili9341_puts_p(PSTR("GPS"));
-	if (gps_valid) {
+	if (redraw) {
+		ili9341_setCursor(10,37);
+		ili9341_puts_p(PSTR("Digits"));
+		ili9341_setCursor(10,91);
+		ili9341_puts_p(PSTR("GPS"));
+	}
+	if (gps_valid && (redraw || gps_time.tm_sec != shown_sec)) {
+		shown_sec = gps_time.tm_sec;
 		ili9341_setCursor(10,108);
 		ili9341_puts_p(PSTR("Altitude "));
 		drawInt(altitude);
@@ -924,8 +1148,7 @@ static void updateEtc(void) {
 		ili9341_setCursor(10,153);
 		time_t now = mk_gmtime(&gps_time);
 		ctime_r(&now, buffer);
-		ili9341_puts(buffer);
-		ili9341_clearTextArea(192);
+		ili9341_putsClear(buffer, 192);
 		ili9341_setCursor(10,168);
 		ili9341_puts_p(PSTR("Satellites "));
 		drawInt(gps_numsats);
@@ -937,37 +1160,54 @@ static void updateEtc(void) {
 
 // update names tab
 static void updateNames(void) {
-	static button_t b_key[39];
-	static uint8_t j=0;
-	uint8_t i=0, c, y=80;
+	// one touch point and only shift keeps its value, so keys share the touched index and a look bitmap
+	static uint8_t j=0, shown_name, touched = NO_KEY, shown_keys[(KEY_COUNT + 3) / 4];
+	static bool shift;
+	uint8_t i=0, c, y=80, was_touched = touched;
 	uint16_t x=3;
+	char name[4];
+	readName(j, name);
+	uint8_t k = strlen(name);
+	bool was_shift = shift;
 
 	// draw remote name with cursor
 	ili9341_setTextSize(1);
-	ili9341_setCursor(10,47);
-	ili9341_puts_p(PSTR("Remote station "));
-	drawInt(j);
-	ili9341_puts_p(PSTR(": "));
-	ili9341_puts(remote[j].name);
-	if (action.blink) ili9341_write('_');
-	ili9341_clearTextArea(180);
+	if (redraw || shown_name != ((j << 3) | (k << 1) | action.blink)) {
+		shown_name = (j << 3) | (k << 1) | action.blink;
+		ili9341_setCursor(10,47);
+		ili9341_puts_p(PSTR("Remote station "));
+		drawInt(j);
+		ili9341_puts_p(PSTR(": "));
+		ili9341_puts(name);
+		if (action.blink) ili9341_write('_');
+		ili9341_clearTextArea(180);
+	}
 	// draw and handle buttons
 	ili9341_setFont(cp437font8x8);
 	ili9341_setTextSize(2);
-	uint8_t k = strlen(remote[j].name);
-	while ((c = pgm_read_byte((b_key[29].value) ? &keys2[i] : &keys1[i]))) {
-		b_key[i] = handleButton(x, y, PSTR(""), c, 0, b_key[i]);
-		if (b_key[i].value && c != 0x1E) {
-			b_key[i].value = false;
-			b_key[29].value = false;
-			if (c == 0x18 && j) j--;
-			if (c == 0x19 && j < SENSOR_COUNT-1) j++;
-			if (c == 0x1B) {
-				remote[j].name[k-1] = 0; // backspace
+	while ((c = pgm_read_byte((shift) ? &keys2[i] : &keys1[i]))) {
+		uint8_t *shown = &shown_keys[i >> 2], shift_bits = 2 * (i & 3);
+		button_t key = {.value = i == KEY_SHIFT && shift, .touch = i == was_touched};
+		key.shown = (*shown >> shift_bits) & 3;
+		key = handleButton(x, y, PSTR(""), c, 0, key);
+		*shown = (*shown & ~(3 << shift_bits)) | (key.shown << shift_bits);
+		if (key.touch) touched = i;
+		else if (touched == i) touched = NO_KEY;
+		if (i == KEY_SHIFT) {
+			shift = key.value;
+		} else if (key.value) {
+			shift = false;
+			if (c == 0x18 || c == 0x19) {
+				// select other remote, its name is read in the next pass
+				if (c == 0x18 && j) j--;
+				if (c == 0x19 && j < SENSOR_COUNT-1) j++;
+			} else if (c == 0x1B) {
+				if (k) name[k-1] = 0; // backspace
+				eeprom_update_block(name, &nv.names[j], sizeof(name));
 			} else if (k < 3) {
-				remote[j].name[k] = c;
-				remote[j].name[k+1] = 0;
-				eeprom_update_block(remote[j].name, &nv_names[j], sizeof(remote[j].name));
+				name[k] = c;
+				name[k+1] = 0;
+				eeprom_update_block(name, &nv.names[j], sizeof(name));
 			}
 		}
 		x += 32;
@@ -978,7 +1218,9 @@ static void updateNames(void) {
 		i++;
 		if (i == 20) x += 16;
 	}
-	ili9341_setFont(Arial_bold_14);
+	// all key labels change with shift
+	if (shift != was_shift) redraw_menu = true;
+	ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
 }
 
 // update menu screen
@@ -986,6 +1228,8 @@ static void updateMenu(void) {
 	static button_t b_ok, b_cancel, b_calibrate, b_tab = {.value = 1};
 	uint8_t old_tab = b_tab.value;
 	
+	redraw = redraw_menu;
+	redraw_menu = false;
 	ili9341_setTextSize(2);
 	b_tab = handleButton(0,0,PSTR("Config"),0,TAB_CONFIG,b_tab);
 	b_tab = handleButton(96,0,PSTR("LCD"),0,TAB_LCD,b_tab);
@@ -1011,15 +1255,21 @@ static void updateMenu(void) {
 	}
 	if (b_ok.value) {
 		b_ok.value = false;
-		tz = new_tz;
+		zone = new_zone;
 		dst = b_dst.value;
-		set_dst(dst ? eu_dst : NULL); // daylight saving time
-		set_zone(tz * ONE_HOUR); // adjust time zone
+		// store rule of zone, without daylight saving time when disabled
+		tz_rule_t rule;
+		parseZone(zone, &rule);
+		if (!dst) rule.start.month = 0;
+		// zone last, a power loss in between leaves a valid rule
+		eeprom_update_block(&rule, &nv.rule, sizeof(rule));
+		eeprom_update_byte(&nv.zone, zone);
+		setZone(&rule);
 		drawScreen();
 	}
 	if (b_cancel.value) {
 		b_cancel.value = false;
-		new_tz = tz;
+		new_zone = zone;
 		b_dst.value = dst;
 		OCR0B = old_ocr0b;
 		b_auto_led.value = old_auto_led;
@@ -1036,6 +1286,8 @@ static void updateMenu(void) {
 static void updateCalibrate(void) {
 	static button_t b_done, b_reset;
 	
+	redraw = redraw_menu;
+	redraw_menu = false;
 	ili9341_fillCircle(ts_x,ts_y,3,ILI9341_BLUE);
 	ili9341_setTextSize(2);
 	b_reset = handleButton(200,136,PSTR("Reset"),0,0,b_reset);
@@ -1053,23 +1305,208 @@ static void updateCalibrate(void) {
 	}
 }
 
-// read names from EEPROM if set or use default values
-static void init_eeprom(void) {
-	for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
-		eeprom_read_block(remote[i].name, &nv_names[i], sizeof(remote[i].name));
-		if (remote[i].name[0] == 0xFF) {
-			remote[i].name[0] = '#';
-			remote[i].name[1] = i<0xA ? '0'+i : 'A'+i-0xA;
-			remote[i].name[2] = 0;
+// receive packets from remote sensors
+static bool serviceRadio(void) {
+	PROFILE_START(start);
+	// the receive interrupt only queues complete packets that follow the preamble
+	while (uart_available() >= sizeof(rxData)) {
+		uint16_t crc = 0xffff;
+		for (uint8_t i = 0; i < sizeof(rxData); i++) {
+			uint8_t c = uart_getc();
+			if (i < sizeof(rxData) - sizeof(crc))
+				crc = _crc16_update(crc, c);
+			((uint8_t *)&rxData)[i] = c;
+		}
+		// Validate received packet
+		if (rxData.crc == crc) {
+			uint8_t i = rxData.unit.id;
+			reading_t *r = &remote_reading[i];
+			// rescan range only when a value leaves an extreme
+			bool edge = (remote_enabled & SENSOR_BIT(i)) && (r->temp == remote_range.h_temp || r->temp == remote_range.l_temp ||
+				r->humid == remote_range.h_humid || r->humid == remote_range.l_humid);
+			remote_enabled |= SENSOR_BIT(i);
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE) remote_seen[i] = uptime;
+			remote_unit[i] = rxData.unit;
+			r->temp = constrain(rxData.temp, -400, 1250);
+			//r->humid = (rxData.humid > 999) ? 999 : rxData.humid;
+			r->humid = min(rxData.humid, 999);
+			addReading(&remote_extremes[i], r->temp, r->humid);
+			if (edge) rangeRemote();
+			else widenRange(&remote_range, r->temp, r->humid);
 		}
 	}
+	PROFILE_END(PROFILE_RF, start);
+	return false;
+}
+
+// decode NMEA sentences from GPS
+static bool serviceGps(void) {
+	static time_t last = 0;
+
+	PROFILE_START(start);
+	while (suart_available()) {
+		if (gps_decode(suart_getc())) {
+			altitude = gps_altitude / 100;
+			north = gps_latitude > 0;
+			// sun times only change noticeably when moved an arc minute
+			int32_t lat = gps_latitude / 100, lon = gps_longitude / 100;
+			if (lat / 60 != sun.lat || lon / 60 != sun.lon) {
+				set_position(lat, lon);
+				sun.lat = lat / 60;
+				sun.lon = lon / 60;
+				sun.day = NO_DAY;
+			}
+			time_t timestamp = mk_gmtime(&gps_time);
+			if (difftime(timestamp, last) == 1) {
+				set_system_time(timestamp);
+				time_set = true;
+			}
+			last = timestamp;
+		}
+	}
+	PROFILE_END(PROFILE_NMEA, start);
+	return false;
+}
+
+// open menu on touch and handle menu and calibrate screens
+static bool serviceTouch(void) {
+	uint16_t start = now_ms();
+
+	if (xpt2046_isTouching() && view == SCREEN) {
+		old_auto_led = b_auto_led.value;
+		old_theme = b_theme.value;
+		old_degrees = b_degrees.value;
+		old_pressure = b_pressure.value;
+		old_rainbow = b_rainbow.value;
+		old_ocr0b = OCR0B;
+		if (ts_xMax != ts_xMin)
+			drawMenu();
+		else
+			drawCalibrate();
+	}
+	if (view == SCREEN) return false;
+	PROFILE_START(menu_start);
+	xpt2046_getPosition(0xff, rotation);
+	if (view == MENU)
+		updateMenu();
+	else
+		updateCalibrate();
+	PROFILE_END(PROFILE_MENU, menu_start);
+	if (view) {
+		ili9341_setCursor(1,225);
+		drawInt(now_ms() - start);
+		ili9341_putsClear_p(PSTR("ms"), 49);
+	}
+	return false;
+}
+
+// adjust back light to ambient light
+static bool serviceBacklight(void) {
+	if (b_auto_led.value)
+		OCR0B = ~read_adc(2);
+	return false;
+}
+
+// store history every interval, one EEPROM write per run, base station last
+static bool serviceHistory(void) {
+	static uint8_t i = 0xFF; // not storing
+	time_t now;
+
+	if (i == 0xFF) {
+		if (!time_set) return false;
+		time(&now);
+		uint32_t seq = now / (HISTORY_INTERVAL * 60UL);
+		if (history_newest != HISTORY_NONE && seq <= history_newest) return false;
+		if (history_begin(seq)) i = 0;
+		return true;
+	}
+	if (i < SENSOR_COUNT) {
+		if (history_append(i, (remote_enabled & SENSOR_BIT(i)) && !remote_unit[i].result, remote_reading[i].temp, remote_reading[i].humid)) i++;
+		return true;
+	}
+	if (i == SENSOR_COUNT) {
+		if (history_append(SENSOR_COUNT, true, render.temp / 10, render.humid)) i++;
+		return true;
+	}
+	if (!history_commit()) return true;
+	i = 0xFF;
+	return false;
+}
+
+// update main screen once per second, one region per run
+static bool serviceScreen(void) {
+	uint16_t start = now_ms();
+
+	if (view != SCREEN) {
+		// stop update, screen is drawn completely when shown again
+		render.step = STEP_READ;
+		return false;
+	}
+	if (render.step == STEP_READ) {
+		if (!action.update_screen) return false;
+		action.update_screen = false;
+	}
+	bool more = updateScreen();
+	render.time += now_ms() - start;
+	if (!more) {
+		ili9341_setCursor(272,225);
+		drawInt(render.time);
+		ili9341_putsClear_p(PSTR("ms"), 319);
+	}
+	return more;
+}
+
+#ifdef PROFILE
+// send one line of the profile report
+static bool serviceProfile(void) {
+	static uint8_t stage = 0;
+
+	if (!stage) profile_value(PSTR("\r\nspi_saved"), ili9341_savedBytes());
+	stage = profile_report(stage);
+	return false;
+}
+#endif
+
+typedef struct {
+	bool (*run)(void);	// returns true when task has work left and must run again
+	uint16_t period;	// ms between runs, 0 is every pass
+	uint16_t due;		// millis of next run
+} task_t;
+
+// tasks in order of priority, input is serviced first
+task_t tasks[] = {
+	{.run = serviceRadio}, {.run = serviceGps}, {.run = serviceTouch}, {.run = serviceBacklight, .period = 50},
+	{.run = serviceHistory, .period = 1000}, {.run = serviceScreen},
+#ifdef PROFILE
+	{.run = serviceProfile, .period = 60000 / PROFILE_COUNT} // a line fits the transmit buffer, full report every minute
+#endif
+};
+
+#define TASK_COUNT (sizeof(tasks) / sizeof(tasks[0]))
+#define TASK_BUDGET 20 // ms per pass, remaining tasks run first in the next pass
+
+// run due tasks by priority until budget is used up
+static void runTasks(void) {
+	static uint8_t first = 0; // task after the one that used up the budget
+	uint16_t start = now_ms();
+	uint8_t i = first;
+	PROFILE_START(loop_start);
+	first = 0;
+	for (uint8_t n = 0; n < TASK_COUNT; n++, i = (i + 1) % TASK_COUNT) {
+		task_t *t = &tasks[i];
+		if ((int16_t)(now_ms() - t->due) < 0) continue;
+		bool more = t->run();
+		uint16_t now = now_ms();
+		t->due = (more) ? now : now + t->period;
+		if ((uint16_t)(now - start) >= TASK_BUDGET) {
+			first = (i + 1) % TASK_COUNT;
+			break;
+		}
+	}
+	PROFILE_END(PROFILE_LOOP, loop_start);
 }
 
 int main(void) {
-	uint8_t length = 0xff, prev, c = 0;
-	uint16_t crc = 0;
-	time_t last = 0;
-	
 	timer0_init();
 	timer2_init();
 	uart_init(UART_BAUD_SELECT(1200, F_CPU));
@@ -1086,83 +1523,12 @@ int main(void) {
 	suart_init();
 	init_adc();
 	init_period();
-	set_zone(1 * ONE_HOUR); // adjust time zone
-	set_dst(eu_dst);        // enable daylight saving time
-	init_eeprom();
+	init_nvram();
+	init_zone();
+	history_init();
 
 	// Main loop
-	while (1) {
-		uint16_t start = millis;
-		if (xpt2046_isTouching() && view == SCREEN) {
-			old_auto_led = b_auto_led.value;
-			old_theme = b_theme.value;
-			old_degrees = b_degrees.value;
-			old_pressure = b_pressure.value;
-			old_rainbow = b_rainbow.value;
-			old_ocr0b = OCR0B;
-			if (ts_xMax != ts_xMin)
-				drawMenu();
-			else
-				drawCalibrate();
-		}
-		xpt2046_getPosition(0xff, rotation);
-		if (b_auto_led.value)
-			OCR0B = ~read_adc(2); // adjust back light
-		if (view == MENU) {
-			updateMenu();
-		} else if (view == CALIBRATE) {
-			updateCalibrate();
-		} else if (action.update_screen) {
-			action.update_screen = false;
-			updateScreen();
-			ili9341_drawRLEBitmap(294,109,(gps_fix) ? gps_icon : no_gps_icon,24,24,fgcolor, bgcolor);
-			ili9341_setCursor(272,225);
-			drawInt(millis - start);
-			ili9341_puts_p(PSTR("ms"));
-			ili9341_clearTextArea(319);
-		}
-		if (view) {
-			ili9341_setCursor(1,225);
-			drawInt(millis - start);
-			ili9341_puts_p(PSTR("ms"));
-			ili9341_clearTextArea(49);
-		}
-		while (suart_available()) {
-			if (gps_decode(suart_getc())) {
-				altitude = gps_altitude / 100;
-				north = gps_latitude > 0;
-				set_position(gps_latitude / 100, gps_longitude / 100);
-				time_t timestamp = mk_gmtime(&gps_time);
-				if (difftime(timestamp, last) == 1) set_system_time(timestamp);
-				last = timestamp;
-			}
-		}
-		while (uart_available()) {
-			prev = c;
-			c = uart_getc();
-			if (prev == 0x55 && c == 0x55) {
-				// Preamble received
-				length = 0;
-				crc = 0xffff;
-			} else if (length < sizeof(rxData)) {
-				// Receive packet data
-				if (length < sizeof(rxData) - sizeof(crc))
-					crc = _crc16_update(crc, c);
-				((uint8_t *)&rxData)[length++] = c;
-			}
-			if (length == sizeof(rxData)) {
-				// Validate received packet
-				length = 0xff;
-				if (rxData.crc == crc) {
-					remote[rxData.unit.id].enabled = true;
-					remote[rxData.unit.id].age = 0;
-					remote[rxData.unit.id].unit = rxData.unit;
-					remote[rxData.unit.id].temp = constrain(rxData.temp, -400, 1250);
-					//remote[rxData.unit.id].humid = (rxData.humid > 999) ? 999 : rxData.humid;
-					remote[rxData.unit.id].humid = min(rxData.humid, 999);
-				}
-			}
-		}
-	}
+	while (1)
+		runTasks();
 }
 
@@ -0,0 +1,35 @@
+/*
+ * EEPROM layout
+ *
+ * Created: 17-10-2026 14:22:10
+ *
+ * All EEPROM contents are members of one object, so the linker cannot move
+ * the settings of older firmware when a module adds its own. The names and
+ * the touch screen calibration are at the offsets the first firmware had,
+ * where an -Os build placed the calibration words in reverse order. New
+ * members go after them and are only trusted when magic is NV_MAGIC.
+ */
+
+
+#ifndef NVRAM_H_
+#define NVRAM_H_
+
+#include <stdint.h>
+#include "tz.h"
+#include "history.h"
+
+#define NV_NAMES 16		// remote sensors
+#define NV_MAGIC 0x5A	// layout of the members after the calibration
+
+typedef struct {
+	char names[NV_NAMES][4];	// 0
+	uint16_t yMax, yMin, xMax, xMin;	// 64
+	uint8_t magic;		// 72
+	uint8_t zone;		// 73, index of built in zone
+	tz_rule_t rule;		// 74, rule of zone as chosen
+	history_store_t history;	// 85
+} nvram_t;
+
+extern nvram_t EEMEM nv;
+
+#endif /* NVRAM_H_ */
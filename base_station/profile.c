@@ -0,0 +1,122 @@
+/*
+ * Main loop profiler
+ *
+ * Created: 16-10-2026 19:12:40
+ *
+ * Times stages of the main loop with the 1 ms Timer2 interrupt and the
+ * Timer2 counter for sub-ms resolution. Minimum, maximum, mean and a log2
+ * histogram are kept per stage and reported one stage per line over the
+ * UART transmit line.
+ */ 
+
+#ifdef PROFILE
+
+#include <avr/io.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+#include "profile.h"
+#include "uart.h"
+
+#define TICKS_PER_MS (OCR2A + 1)
+
+typedef struct {
+	uint16_t count;
+	uint16_t min, max;	// ticks
+	uint32_t sum;
+	uint16_t hist[PROFILE_BUCKETS];
+} stage_t;
+
+extern volatile uint16_t millis;
+
+static stage_t stages[PROFILE_COUNT];
+
+static const char name_loop[] PROGMEM = "loop";
+static const char name_rf[] PROGMEM = "rf";
+static const char name_nmea[] PROGMEM = "nmea";
+static const char name_menu[] PROGMEM = "menu";
+static const char name_bme280[] PROGMEM = "bme280";
+static const char name_forecast[] PROGMEM = "forecast";
+static const char name_remote[] PROGMEM = "remote";
+
+static PGM_P const names[PROFILE_COUNT] PROGMEM = {
+	name_loop, name_rf, name_nmea, name_menu, name_bme280, name_forecast, name_remote
+};
+
+void profile_start(profile_t *start) {
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+		start->ms = millis;
+		start->tick = TCNT2;
+		// counter cleared but millis not yet incremented
+		if ((TIFR2 & _BV(OCF2A)) && start->tick < OCR2A) start->ms++;
+	}
+}
+
+void profile_end(uint8_t stage, const profile_t *start) {
+	profile_t now;
+	stage_t *s = &stages[stage];
+	profile_start(&now);
+	uint32_t ticks = (uint32_t)(uint16_t)(now.ms - start->ms) * TICKS_PER_MS + now.tick - start->tick;
+	uint16_t t = (ticks > 0xFFFF) ? 0xFFFF : ticks;
+	uint8_t bucket = 0;
+	for (uint16_t v = t >> 6; v && bucket < PROFILE_BUCKETS - 1; v >>= 1)
+		bucket++;
+	if (s->count == 0xFFFF) return; // full until reported
+	if (!s->count || t < s->min) s->min = t;
+	if (t > s->max) s->max = t;
+	s->count++;
+	s->sum += t;
+	s->hist[bucket]++;
+}
+
+static void putNumber(uint32_t value) {
+	char str[11];
+	uint8_t i = sizeof(str) - 1;
+	str[i] = 0;
+	do {
+		str[--i] = '0' + value % 10;
+		value /= 10;
+	} while (value);
+	uart_puts(&str[i]);
+}
+
+// convert ticks to microseconds
+static uint32_t micros(uint32_t ticks) {
+	return ticks * 16 / 3;
+}
+
+// send statistics of stage in microseconds and clear them, returns next stage
+uint8_t profile_report(uint8_t stage) {
+	stage_t *s = &stages[stage];
+	PGM_P name;
+	memcpy_P(&name, &names[stage], sizeof(PGM_P));
+	uart_puts_p(name);
+	uart_puts_P(" n=");
+	putNumber(s->count);
+	if (s->count) {
+		uart_puts_P(" min=");
+		putNumber(micros(s->min));
+		uart_puts_P(" avg=");
+		putNumber(micros(s->sum / s->count));
+		uart_puts_P(" max=");
+		putNumber(micros(s->max));
+		uart_puts_P(" hist=");
+		for (uint8_t i = 0; i < PROFILE_BUCKETS; i++) {
+			if (i) uart_putc(',');
+			putNumber(s->hist[i]);
+		}
+	}
+	uart_puts_P("\r\n");
+	memset(s, 0, sizeof(stage_t));
+	return (stage + 1) % PROFILE_COUNT;
+}
+
+// send name and value of a counter kept elsewhere
+void profile_value(const char *name, uint32_t value) {
+	uart_puts_p(name);
+	uart_putc('=');
+	putNumber(value);
+	uart_puts_P("\r\n");
+}
+
+#endif
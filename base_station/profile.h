@@ -0,0 +1,38 @@
+/*
+ * Main loop profiler
+ *
+ * Created: 16-10-2026 19:12:40
+ */ 
+
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+
+// Define PROFILE in the compiler symbols to enable, costs 200 bytes of SRAM
+
+enum {PROFILE_LOOP, PROFILE_RF, PROFILE_NMEA, PROFILE_MENU, PROFILE_BME280, PROFILE_FORECAST, PROFILE_REMOTE, PROFILE_COUNT};
+
+#define PROFILE_BUCKETS 8 // log2 histogram, first bucket below 64 ticks, last bucket 4096 ticks and above
+
+// time stamp in ticks of Timer2, 64 CPU cycles each
+typedef struct {
+	uint16_t ms;
+	uint8_t tick;
+} profile_t;
+
+#ifdef PROFILE
+#define PROFILE_START(t) profile_t t; profile_start(&t)
+#define PROFILE_END(stage, t) profile_end(stage, &t)
+#else
+#define PROFILE_START(t)
+#define PROFILE_END(stage, t)
+#endif
+
+void profile_start(profile_t *start);
+void profile_end(uint8_t stage, const profile_t *start);
+uint8_t profile_report(uint8_t stage);
+void profile_value(const char *name, uint32_t value);
+
+#endif /* PROFILE_H_ */
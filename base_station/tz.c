@@ -0,0 +1,216 @@
+/*
+ * Time zone rules
+ *
+ * Created: 17-10-2026 01:31:26
+ *
+ * Parses POSIX TZ strings like "CET-1CEST,M3.5.0,M10.5.0/3" and provides the
+ * daylight saving time callback of avr-libc for the rule. The transitions of
+ * a year are calculated when the time leaves the interval that was looked
+ * up before, so a conversion is a comparison and an add. Offsets and
+ * transitions may be at any minute, which covers half and quarter hour
+ * zones, and rules where daylight saving time spans the new year are used
+ * in the southern hemisphere. Only the Mm.w.d date format is supported.
+ */ 
+
+#include "tz.h"
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#define EPOCH_OFFSET 0	// avr-libc counts from 2000
+#else
+#define PROGMEM
+#define PGM_P const char *
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_ptr(addr) (*(const void * const *)(addr))
+#define EPOCH_OFFSET 946684800UL	// host counts from 1970
+#endif
+
+#define SECONDS_PER_DAY 86400UL
+
+// days before month in a year that is not a leap year
+static const uint16_t month_days[] PROGMEM = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365};
+
+// one rule per UTC offset, with the daylight saving time of the largest region
+static const char zone_0[] PROGMEM = "<-12>12";
+static const char zone_1[] PROGMEM = "<-11>11";
+static const char zone_2[] PROGMEM = "HST10";
+static const char zone_3[] PROGMEM = "<-0930>9:30";
+static const char zone_4[] PROGMEM = "AKST9AKDT,M3.2.0,M11.1.0";
+static const char zone_5[] PROGMEM = "PST8PDT,M3.2.0,M11.1.0";
+static const char zone_6[] PROGMEM = "MST7MDT,M3.2.0,M11.1.0";
+static const char zone_7[] PROGMEM = "CST6CDT,M3.2.0,M11.1.0";
+static const char zone_8[] PROGMEM = "EST5EDT,M3.2.0,M11.1.0";
+static const char zone_9[] PROGMEM = "AST4ADT,M3.2.0,M11.1.0";
+static const char zone_10[] PROGMEM = "NST3:30NDT,M3.2.0,M11.1.0";
+static const char zone_11[] PROGMEM = "<-03>3";
+static const char zone_12[] PROGMEM = "<-02>2";
+static const char zone_13[] PROGMEM = "<-01>1";
+static const char zone_14[] PROGMEM = "GMT0BST,M3.5.0/1,M10.5.0";
+static const char zone_15[] PROGMEM = "CET-1CEST,M3.5.0,M10.5.0/3";
+static const char zone_16[] PROGMEM = "EET-2EEST,M3.5.0/3,M10.5.0/4";
+static const char zone_17[] PROGMEM = "MSK-3";
+static const char zone_18[] PROGMEM = "<+0330>-3:30";
+static const char zone_19[] PROGMEM = "<+04>-4";
+static const char zone_20[] PROGMEM = "<+0430>-4:30";
+static const char zone_21[] PROGMEM = "PKT-5";
+static const char zone_22[] PROGMEM = "IST-5:30";
+static const char zone_23[] PROGMEM = "<+0545>-5:45";
+static const char zone_24[] PROGMEM = "<+06>-6";
+static const char zone_25[] PROGMEM = "<+0630>-6:30";
+static const char zone_26[] PROGMEM = "<+07>-7";
+static const char zone_27[] PROGMEM = "CST-8";
+static const char zone_28[] PROGMEM = "<+0845>-8:45";
+static const char zone_29[] PROGMEM = "JST-9";
+static const char zone_30[] PROGMEM = "ACST-9:30ACDT,M10.1.0,M4.1.0/3";
+static const char zone_31[] PROGMEM = "AEST-10AEDT,M10.1.0,M4.1.0/3";
+static const char zone_32[] PROGMEM = "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0";
+static const char zone_33[] PROGMEM = "<+11>-11";
+static const char zone_34[] PROGMEM = "NZST-12NZDT,M9.5.0,M4.1.0/3";
+static const char zone_35[] PROGMEM = "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45";
+static const char zone_36[] PROGMEM = "<+13>-13";
+static const char zone_37[] PROGMEM = "<+14>-14";
+static PGM_P const zones[TZ_ZONES] PROGMEM = {
+	zone_0, zone_1, zone_2, zone_3, zone_4, zone_5, zone_6, zone_7,
+	zone_8, zone_9, zone_10, zone_11, zone_12, zone_13, zone_14, zone_15,
+	zone_16, zone_17, zone_18, zone_19, zone_20, zone_21, zone_22, zone_23,
+	zone_24, zone_25, zone_26, zone_27, zone_28, zone_29, zone_30, zone_31,
+	zone_32, zone_33, zone_34, zone_35, zone_36, zone_37
+};
+
+static tz_rule_t rule;
+static uint32_t from, until;	// seconds since 2000 where the cached state is valid
+static bool active;				// daylight saving time in cached interval
+
+// parse number, returns NULL when there are no digits
+static const char *parseNumber(const char *str, int16_t *value) {
+	if (*str < '0' || *str > '9') return NULL;
+	*value = 0;
+	while (*str >= '0' && *str <= '9')
+		*value = *value * 10 + *str++ - '0';
+	return str;
+}
+
+// parse [+|-]hh[:mm[:ss]] to minutes, seconds are ignored
+static const char *parseTime(const char *str, int16_t *minutes) {
+	int16_t value;
+	bool negative = *str == '-';
+	if (*str == '+' || *str == '-') str++;
+	if (!(str = parseNumber(str, &value))) return NULL;
+	*minutes = value * 60;
+	if (*str == ':') {
+		if (!(str = parseNumber(str + 1, &value))) return NULL;
+		*minutes += value;
+		if (*str == ':' && !(str = parseNumber(str + 1, &value))) return NULL;
+	}
+	if (negative) *minutes = -*minutes;
+	return str;
+}
+
+// skip zone name, alphabetic or quoted in angle brackets
+static const char *parseName(const char *str) {
+	const char *start = str;
+	if (*str == '<') {
+		while (*str && *str != '>') str++;
+		return (*str) ? str + 1 : NULL;
+	}
+	while ((*str >= 'A' && *str <= 'Z') || (*str >= 'a' && *str <= 'z')) str++;
+	return (str - start >= 3) ? str : NULL;
+}
+
+// parse ,Mm.w.d[/time]
+static const char *parseDate(const char *str, tz_date_t *date) {
+	int16_t month, week, day;
+	if (*str++ != ',' || *str++ != 'M') return NULL;
+	if (!(str = parseNumber(str, &month)) || *str++ != '.') return NULL;
+	if (!(str = parseNumber(str, &week)) || *str++ != '.') return NULL;
+	if (!(str = parseNumber(str, &day))) return NULL;
+	if (month < 1 || month > 12 || week < 1 || week > 5 || day > 6) return NULL;
+	date->month = month;
+	date->week_day = (week << 4) | day;
+	date->time = 120;
+	if (*str == '/') str = parseTime(str + 1, &date->time);
+	return str;
+}
+
+// parse POSIX TZ string, returns false when not valid
+bool tz_parse(const char *str, tz_rule_t *rule) {
+	int16_t std, dst;
+	if (!(str = parseName(str)) || !(str = parseTime(str, &std))) return false;
+	// POSIX offsets are west of UTC
+	rule->offset = -std;
+	rule->save = 0;
+	rule->start.month = rule->end.month = 0;
+	if (!*str) return true;
+	if (!(str = parseName(str))) return false;
+	dst = std - 60;
+	if (*str && *str != ',' && !(str = parseTime(str, &dst))) return false;
+	rule->save = std - dst;
+	// same rule as the USA when no dates are given
+	if (!*str) str = ",M3.2.0,M11.1.0";
+	if (!(str = parseDate(str, &rule->start)) || !(str = parseDate(str, &rule->end))) return false;
+	return !*str;
+}
+
+// days since 2000 to first day of month, year since 2000
+static uint16_t daysSince2000(uint8_t year, uint8_t month) {
+	year += (month - 1) / 12;
+	month = (month - 1) % 12;
+	uint16_t days = year * 365U + (year + 3) / 4 - (year > 100);
+	if (month > 1 && year % 4 == 0 && year != 100) days++;
+	return days + pgm_read_word(&month_days[month]);
+}
+
+// seconds since 2000 of transition in year, offset in minutes of the local time of date
+static uint32_t transition(uint8_t year, const tz_date_t *date, int16_t offset) {
+	uint16_t first = daysSince2000(year, date->month);
+	uint16_t next = daysSince2000(year, date->month + 1);
+	// 2000-01-01 was a Saturday
+	uint16_t day = first + ((date->week_day & 0x0F) + 7 - (first + 6) % 7) % 7 + ((date->week_day >> 4) - 1) * 7;
+	while (day >= next) day -= 7;
+	return day * SECONDS_PER_DAY + (int32_t)(date->time - offset) * 60;
+}
+
+// look up daylight saving time of the year around t
+static void update(uint32_t t) {
+	uint8_t year = t / SECONDS_PER_DAY / 365;
+	while (daysSince2000(year, 1) * SECONDS_PER_DAY > t) year--;
+	uint32_t start = transition(year, &rule.start, rule.offset);
+	uint32_t end = transition(year, &rule.end, rule.offset + rule.save);
+	from = daysSince2000(year, 1) * SECONDS_PER_DAY;
+	until = daysSince2000(year + 1, 1) * SECONDS_PER_DAY;
+	// in the southern hemisphere daylight saving time spans the new year
+	bool north = start < end;
+	uint32_t first = (north) ? start : end, second = (north) ? end : start;
+	if (t < first) {
+		until = first;
+		active = !north;
+	} else if (t < second) {
+		from = first;
+		until = second;
+		active = north;
+	} else {
+		from = second;
+		active = !north;
+	}
+}
+
+// TZ string of zone in program memory, NULL when index is out of range
+PGM_P tz_zone(uint8_t index) {
+	if (index >= TZ_ZONES) return NULL;
+	return pgm_read_ptr(&zones[index]);
+}
+
+// use rule for daylight saving time
+void tz_set(const tz_rule_t *r) {
+	rule = *r;
+	from = until = 0;
+}
+
+// daylight saving time callback for set_dst(), returns seconds to add to standard time
+int tz_dst(const time_t *timer, int32_t *z) {
+	uint32_t t = *timer - EPOCH_OFFSET;
+	(void)z;
+	if (!rule.start.month) return 0;
+	if (t < from || t >= until) update(t);
+	return (active) ? rule.save * 60 : 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * Time zone rules
+ *
+ * Created: 17-10-2026 01:31:26
+ */ 
+
+
+#ifndef TZ_H_
+#define TZ_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#define TZ_ZONES 38		// number of built in zones
+#define TZ_LENGTH 48	// maximum length of TZ string
+
+typedef struct {
+	uint8_t month;		// 1-12, 0 when there is no daylight saving time
+	uint8_t week_day;	// week 1-5 (5 is last) in high nibble, day of week 0-6 (Sunday) in low nibble
+	int16_t time;		// minutes after local midnight
+} tz_date_t;
+
+typedef struct {
+	int16_t offset;		// standard time in minutes east of UTC
+	int8_t save;		// minutes added during daylight saving time
+	tz_date_t start;	// in local standard time
+	tz_date_t end;		// in local daylight saving time
+} tz_rule_t;
+
+bool tz_parse(const char *str, tz_rule_t *rule);
+const char *tz_zone(uint8_t index);
+void tz_set(const tz_rule_t *rule);
+int tz_dst(const time_t *timer, int32_t *z);
+
+#endif /* TZ_H_ */
@@ -369,6 +369,11 @@ Date        Description
 			static volatile uint8_t UART_LastRxError;
 		#endif
 		
+		#if UART_RX0_FRAME_SIZE
+			static uint8_t UART_RxFrame;        /* index of last byte of frame being received */
+			static uint8_t UART_RxLength = 0xFF; /* bytes of frame received, 0xFF when hunting for preamble */
+			static uint8_t UART_RxPrev;
+		#endif
 	#endif
 #endif
 
@@ -466,6 +471,26 @@ Purpose:  called when the UART has received a character
     lastRxError = (usr & (_BV(FE)|_BV(DOR)));
 #endif
         
+#if UART_RX0_FRAME_SIZE
+    if (UART_RxPrev == UART_RX0_PREAMBLE && data == UART_RX0_PREAMBLE) {
+        /* preamble received, (re)start frame */
+        UART_RxLength = 0;
+        UART_RxFrame = UART_RxHead;
+    } else if (UART_RxLength < UART_RX0_FRAME_SIZE) {
+        tmphead = (UART_RxFrame + 1) & UART_RX0_BUFFER_MASK;
+        if (tmphead == UART_RxTail) {
+            /* error: receive buffer overflow, drop frame */
+            lastRxError = UART_BUFFER_OVERFLOW >> 8;
+            UART_RxLength = 0xFF;
+        } else {
+            UART_RxFrame = tmphead;
+            UART_RxBuf[tmphead] = data;
+            /* make frame available when complete */
+            if (++UART_RxLength == UART_RX0_FRAME_SIZE) UART_RxHead = tmphead;
+        }
+    }
+    UART_RxPrev = data;
+#else
     /* calculate buffer index */ 
     tmphead = (UART_RxHead + 1) & UART_RX0_BUFFER_MASK;
     
@@ -478,6 +503,7 @@ Purpose:  called when the UART has received a character
         /* store received data in buffer */
         UART_RxBuf[tmphead] = data;
     }
+#endif
     UART_LastRxError = lastRxError;   
 }
 
@@ -98,10 +98,24 @@ were adapted from the Arduino HardwareSerial.h library by Tim Sharpe on
 //#define USART2_ENABLED 
 //#define USART3_ENABLED
 
+/* Receive only frames of fixed size that follow two preamble bytes on USART0 */
+/* Other bytes are dropped in the receive interrupt, a frame becomes available when complete */
+
+#ifndef UART_RX0_FRAME_SIZE
+	#define UART_RX0_FRAME_SIZE 7 /**< Size of frame after preamble, sizeof(packet_t) in main.c, 0 receives all bytes */
+#endif
+#ifndef UART_RX0_PREAMBLE
+	#define UART_RX0_PREAMBLE 0x55 /**< Preamble byte, sent twice before each frame */
+#endif
+
 /* Set size of receive and transmit buffers */
 
 #ifndef UART_RX0_BUFFER_SIZE
-	#define UART_RX0_BUFFER_SIZE 128 /**< Size of the circular receive buffer, must be power of 2 */
+	#if UART_RX0_FRAME_SIZE
+		#define UART_RX0_BUFFER_SIZE 32 /**< Size of the circular receive buffer, holds 4 frames */
+	#else
+		#define UART_RX0_BUFFER_SIZE 128 /**< Size of the circular receive buffer, must be power of 2 */
+	#endif
 #endif
 #ifndef UART_RX1_BUFFER_SIZE
 	#define UART_RX1_BUFFER_SIZE 128 /**< Size of the circular receive buffer, must be power of 2 */
@@ -114,7 +128,11 @@ were adapted from the Arduino HardwareSerial.h library by Tim Sharpe on
 #endif
 
 #ifndef UART_TX0_BUFFER_SIZE
-	#define UART_TX0_BUFFER_SIZE 128 /**< Size of the circular transmit buffer, must be power of 2 */
+	#ifdef PROFILE
+		#define UART_TX0_BUFFER_SIZE 128 /**< Size of the circular transmit buffer, holds a line of the profile report */
+	#else
+		#define UART_TX0_BUFFER_SIZE 16 /**< Size of the circular transmit buffer, only start-up messages are sent */
+	#endif
 #endif
 #ifndef UART_TX1_BUFFER_SIZE
 	#define UART_TX1_BUFFER_SIZE 128 /**< Size of the circular transmit buffer, must be power of 2 */
@@ -0,0 +1,48 @@
+/*
+ * Unit conversion
+ *
+ * Created: 17-10-2026 00:04:16
+ *
+ * Converts readings to the selected display unit with fixed point factors,
+ * so no floating point code is needed. Results are rounded to the nearest
+ * last digit, tools/unitcheck.c compares them with floating point.
+ */ 
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#endif
+#include "units.h"
+
+// 2^24 divided by Pa per last digit of hPa, mmHg, "Hg and psi
+static const uint32_t pressure_factor[] PROGMEM = {
+	1677722,	// 10
+	1258398,	// 13.3322
+	495431,		// 33.8639
+	243270		// 68.9655
+};
+
+#define FAHRENHEIT_FACTOR 117965 // 1.8 times 2^16
+
+// convert pressure in Pa to selected unit, scaled by its number of decimals
+int16_t units_pressure(int32_t pressure, uint8_t unit) {
+	uint32_t factor = pgm_read_dword(&pressure_factor[unit - 1]);
+	uint32_t value = (pressure < 0) ? -pressure : pressure;
+	// multiply in two parts to stay within 32 bits, result has 16 fraction bits
+	value = (value >> 8) * factor + (((value & 0xFF) * factor) >> 8);
+	int16_t result = (value + 0x8000) >> 16;
+	return (pressure < 0) ? -result : result;
+}
+
+// number of decimals of pressure unit
+uint8_t units_decimals(uint8_t unit) {
+	return (unit == PRESSURE_INHG || unit == PRESSURE_PSI) ? 2 : 1;
+}
+
+// convert scaled temperature in DegC to selected unit
+int16_t units_temp(int16_t temp, uint8_t unit) {
+	if (unit == DEG_CELSIUS) return temp;
+	return (((int32_t)temp * FAHRENHEIT_FACTOR + 0x8000) >> 16) + 320;
+}
@@ -0,0 +1,20 @@
+/*
+ * Unit conversion
+ *
+ * Created: 17-10-2026 00:04:16
+ */ 
+
+
+#ifndef UNITS_H_
+#define UNITS_H_
+
+#include <stdint.h>
+
+enum {DEG_CELSIUS = 1, DEG_FAHRENHEIT};
+enum {PRESSURE_HPA = 1, PRESSURE_MMHG, PRESSURE_INHG, PRESSURE_PSI};
+
+int16_t units_pressure(int32_t pressure, uint8_t unit);
+uint8_t units_decimals(uint8_t unit);
+int16_t units_temp(int16_t temp, uint8_t unit);
+
+#endif /* UNITS_H_ */
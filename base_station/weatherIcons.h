@@ -10,146 +10,146 @@
 #define WEATHERICONS_H_
 
 const char clear_icon[] PROGMEM = {
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x9e, 0x03, 0xb7, 0x07, 0xb8, 0x0f,
-	0xb8, 0x0f, 0xb8, 0x0f, 0xac, 0x01, 0x60, 0x03, 0x40, 0xa2, 0x0f, 0x40,
-	0x07, 0x60, 0x03, 0x9c, 0x1f, 0x40, 0x07, 0x70, 0x03, 0x9d, 0x1f, 0x40,
-	0x01, 0x7c, 0xa4, 0x1f, 0x8d, 0x1f, 0xa4, 0x0f, 0x8c, 0x0f, 0xa5, 0x07,
-	0x7e, 0x60, 0x01, 0xa4, 0x61, 0xc7, 0x10, 0xac, 0xcd, 0xb0, 0x7f, 0x7c,
-	0x01, 0xaa, 0x0f, 0x70, 0x03, 0xa9, 0x0f, 0x40, 0x0f, 0xaa, 0x0f, 0x00,
-	0x0f, 0xa0, 0x3f, 0x38, 0x8a, 0x07, 0x3f, 0x97, 0xc7, 0x3c, 0x8a, 0x4f,
-	0x7f, 0x97, 0xc7, 0x3c, 0x8a, 0x4f, 0x7f, 0x98, 0x7f, 0x38, 0x8a, 0x47,
-	0x3f, 0xa2, 0x07, 0x87, 0x07, 0xa9, 0x0f, 0x00, 0x0f, 0xaa, 0x0f, 0x00,
-	0x0f, 0xab, 0x0f, 0x60, 0x03, 0xaa, 0x7f, 0x7c, 0x01, 0xab, 0xcd, 0xad,
-	0x47, 0xc8, 0x38, 0xa7, 0x0f, 0x7c, 0x41, 0x07, 0xa2, 0x1f, 0x8d, 0x1f,
-	0xa2, 0x1f, 0x8f, 0x1f, 0xa0, 0x1f, 0x00, 0x03, 0x70, 0x03, 0x9c, 0x0f,
-	0x40, 0x07, 0x60, 0x03, 0x9d, 0x03, 0x60, 0x03, 0x60, 0xaf, 0x0f, 0xb8,
-	0x0f, 0xb8, 0x0f, 0xb8, 0x0f, 0xb8, 0x0f, 0xb9, 0x03, 0xbf, 0xbf, 0xbf,
-	0xbf, 0xbf, 0xbf, 0xbf, 0x99
+	0x9e, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xbc, 0xc2, 0xbc, 0xc3,
+	0xbb, 0xc3, 0xbb, 0xc3, 0xaf, 0x01, 0x60, 0x03, 0x40, 0xa2, 0xc3, 0x88,
+	0xc3, 0x88, 0xc3, 0xa1, 0xc4, 0x87, 0xc3, 0x87, 0xc4, 0xa2, 0x1f, 0x40,
+	0x01, 0x7c, 0xa4, 0xc4, 0x8f, 0xc4, 0xa6, 0xc3, 0x8f, 0xc3, 0xa8, 0x07,
+	0x7e, 0x84, 0xc2, 0xa8, 0x04, 0xc7, 0x43, 0xae, 0xcd, 0xb0, 0xc6, 0x81,
+	0xc5, 0xb0, 0xc3, 0x86, 0xc4, 0xae, 0xc3, 0x88, 0xc4, 0xad, 0xc3, 0x89,
+	0xc3, 0xa3, 0xc5, 0x70, 0x8b, 0x07, 0xc5, 0x98, 0xc6, 0x79, 0x8a, 0x1e,
+	0xc7, 0x97, 0xc6, 0x79, 0x8a, 0x1e, 0xc7, 0x98, 0xc5, 0x71, 0x8a, 0x0e,
+	0xc6, 0xa3, 0xc2, 0x8b, 0xc2, 0xad, 0xc3, 0x89, 0xc3, 0xad, 0xc3, 0x89,
+	0xc3, 0xae, 0xc3, 0x87, 0xc3, 0xaf, 0xc6, 0x81, 0xc5, 0xb1, 0xcd, 0xac,
+	0x0e, 0xc8, 0x71, 0xa7, 0x1e, 0x78, 0x03, 0xc3, 0xa6, 0xc4, 0x8f, 0xc4,
+	0xa4, 0xc4, 0x91, 0xc4, 0xa2, 0xc4, 0x88, 0xc1, 0x88, 0xc4, 0xa1, 0xc3,
+	0x88, 0xc3, 0x88, 0xc3, 0xa2, 0x03, 0x60, 0x03, 0x60, 0xaf, 0xc3, 0xbb,
+	0xc3, 0xbb, 0xc3, 0xbb, 0xc3, 0xbb, 0xc3, 0xbc, 0xc1, 0x9e, 0xbf, 0xbf,
+	0xbf, 0xbf, 0xbf, 0xbf, 0xbf
 };
 
 const char nt_clear_icon[] PROGMEM = {
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-	0xbf, 0x9d, 0xc7, 0xb4, 0xc9, 0xb4, 0xc9, 0xb3, 0xca, 0xb4, 0x1f, 0x0f,
-	0xb0, 0x1f, 0x0e, 0xb0, 0x0f, 0x1e, 0xb1, 0x0f, 0x1e, 0xb0, 0x0f, 0x1c,
-	0xb1, 0x07, 0x1c, 0xb0, 0x0f, 0x78, 0xb1, 0x0f, 0x78, 0xb1, 0x0f, 0x78,
-	0xb1, 0x0f, 0x70, 0xb1, 0x0f, 0x70, 0x01, 0xaa, 0x0f, 0x60, 0x03, 0xaa,
-	0x0f, 0x60, 0x03, 0xab, 0x07, 0x60, 0x03, 0xaa, 0x0f, 0x40, 0x0f, 0xaa,
-	0x1f, 0x00, 0x7f, 0xab, 0x0f, 0x00, 0xc9, 0xa8, 0x1f, 0x87, 0x7f, 0xa9,
-	0x3f, 0x87, 0x3f, 0xaa, 0xc7, 0x70, 0x0f, 0xab, 0xcf, 0xb0, 0xcd, 0xb3,
-	0xc8, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-	0xbf, 0xbf, 0xbf, 0x99
+	0x9d, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+	0xbf, 0xbf, 0xc7, 0xb4, 0xc9, 0xb4, 0xc9, 0xb3, 0xca, 0xb4, 0x1f, 0xc3,
+	0xb3, 0xc3, 0x71, 0xb1, 0x3c, 0x78, 0xb1, 0x3c, 0x78, 0xb0, 0x3c, 0x70,
+	0xb1, 0x1c, 0x70, 0xb2, 0x0f, 0x78, 0xb1, 0x0f, 0x78, 0xb1, 0x0f, 0x78,
+	0xb1, 0x0f, 0x70, 0xb1, 0xc3, 0x86, 0xc3, 0xb0, 0xc3, 0x87, 0xc3, 0xaf,
+	0xc3, 0x87, 0xc3, 0xb0, 0xc2, 0x88, 0xc3, 0xaf, 0xc3, 0x88, 0xc4, 0xad,
+	0xc4, 0x88, 0xc6, 0xab, 0xc3, 0x89, 0xc9, 0xa8, 0xc4, 0x89, 0xc6, 0xa9,
+	0xc5, 0x88, 0xc5, 0xab, 0xc7, 0x83, 0xc6, 0xae, 0xcf, 0xb0, 0xcd, 0xb3,
+	0xc8, 0x99, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+	0xbf, 0xbf, 0xbf, 0xbf
 };
 
 const char mostlyclear_icon[] PROGMEM = {
-	0xbf, 0xbf, 0xa8, 0x03, 0xb7, 0x07, 0xb8, 0x07, 0xb8, 0x07, 0xb8, 0x07,
-	0xac, 0x01, 0x60, 0x01, 0x20, 0xa2, 0x0f, 0x40, 0x03, 0x60, 0x01, 0x9c,
-	0x1f, 0x40, 0x03, 0x70, 0x01, 0x9c, 0x3f, 0x00, 0x01, 0x78, 0x01, 0x9e,
-	0x0f, 0x8d, 0x1f, 0xa3, 0x1f, 0x8c, 0x1f, 0xa5, 0x0f, 0x7e, 0x63, 0x03,
-	0xa5, 0x71, 0xc7, 0xa7, 0xc7, 0x70, 0xca, 0xa3, 0xd1, 0x60, 0x07, 0x9d,
-	0xd2, 0x87, 0x0f, 0x9c, 0x7f, 0x70, 0x1f, 0x87, 0x0f, 0x9a, 0x1f, 0x87,
-	0x1f, 0x87, 0x0f, 0x99, 0x1f, 0x89, 0x1f, 0x87, 0x47, 0x1f, 0x90, 0x1f,
-	0x8b, 0x7f, 0x00, 0x67, 0x7f, 0x90, 0x0f, 0x8c, 0xc7, 0x60, 0x79, 0x1f,
-	0x8d, 0x0f, 0x8e, 0xc7, 0x70, 0x78, 0x07, 0x88, 0xc7, 0x92, 0xc8, 0x1e,
-	0x92, 0xc8, 0x97, 0xc9, 0x93, 0xc9, 0x99, 0x7f, 0x93, 0x3f, 0x06, 0x96,
-	0x7f, 0x92, 0x1f, 0x9f, 0x1f, 0x91, 0x0f, 0x9f, 0x0f, 0x90, 0x0f, 0xa1,
-	0x67, 0x8f, 0x0f, 0xa1, 0x77, 0x03, 0x88, 0x07, 0xa1, 0x67, 0x07, 0x88,
-	0x07, 0xa0, 0x0f, 0x1f, 0x89, 0x0f, 0xa0, 0x0f, 0x1e, 0x89, 0x0f, 0x9f,
-	0x0f, 0x38, 0x8b, 0x0f, 0x9d, 0x1f, 0x60, 0x8c, 0x1f, 0x9c, 0x1f, 0x95,
-	0x3f, 0x06, 0x91, 0xc7, 0x98, 0xe5, 0x9a, 0xe2, 0x9e, 0xde, 0xbf, 0xbf,
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x96
+	0xa8, 0xbf, 0xbf, 0xc1, 0xbc, 0xc2, 0xbc, 0xc2, 0xbc, 0xc2, 0xbc, 0xc2,
+	0xaf, 0x02, 0x40, 0x03, 0x40, 0xa3, 0xc3, 0x88, 0xc2, 0x89, 0xc2, 0xa2,
+	0xc4, 0x87, 0xc2, 0x88, 0xc3, 0xa2, 0xc5, 0x87, 0xc0, 0x88, 0xc4, 0xa4,
+	0xc3, 0x90, 0xc4, 0xa5, 0xc4, 0x8e, 0xc4, 0xa7, 0xc3, 0x83, 0xc7, 0x78,
+	0xa7, 0x08, 0xca, 0xa7, 0xc7, 0x83, 0xcd, 0xa3, 0xd1, 0x84, 0xc4, 0xa1,
+	0xd2, 0x87, 0xc3, 0x9f, 0xc6, 0x83, 0xc7, 0x89, 0xc3, 0x9d, 0xc4, 0x89,
+	0xc4, 0x89, 0xc3, 0x9c, 0xc4, 0x8b, 0xc4, 0x88, 0x0e, 0xc5, 0x92, 0xc4,
+	0x8d, 0xc6, 0x84, 0x1c, 0xc8, 0x90, 0xc3, 0x8f, 0xc7, 0x82, 0x1c, 0xc8,
+	0x8f, 0xc3, 0x91, 0xc7, 0x70, 0x82, 0xc6, 0x8c, 0xc7, 0x92, 0xc6, 0x7b,
+	0x94, 0xc8, 0x97, 0xc9, 0x93, 0xc9, 0x99, 0xc6, 0x93, 0xc2, 0x67, 0x9a,
+	0xc6, 0x92, 0xc4, 0xa1, 0xc4, 0x93, 0xc3, 0xa2, 0xc3, 0x93, 0xc3, 0xa4,
+	0x67, 0x8f, 0xc3, 0xa1, 0x38, 0xc4, 0x8d, 0xc2, 0xa3, 0x1c, 0xc4, 0x8c,
+	0xc2, 0xa4, 0x0f, 0xc4, 0x8b, 0xc3, 0xa1, 0x3c, 0x78, 0x8b, 0xc3, 0xa1,
+	0x1e, 0x70, 0x8c, 0xc3, 0xa0, 0x1f, 0x60, 0x8c, 0xc4, 0x9e, 0xc4, 0x97,
+	0xc2, 0x67, 0x95, 0xc7, 0x98, 0xe5, 0x9a, 0xe2, 0x9e, 0xde, 0x96, 0xbf,
+	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf
 };
 
 const char nt_mostlyclear_icon[] PROGMEM = {
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xaa, 0x0f, 0xb6, 0x1f,
-	0xb7, 0x3f, 0xb7, 0x7f, 0xb7, 0xc7, 0xb7, 0xc7, 0xb6, 0x4f, 0x03, 0xb1,
-	0x4f, 0x07, 0xa8, 0xcb, 0x78, 0x01, 0xa3, 0xcd, 0x70, 0x03, 0x03, 0x9a,
-	0xd0, 0x70, 0xc7, 0x9e, 0x7f, 0x70, 0x0f, 0x7c, 0x1f, 0x9b, 0x1f, 0x87,
-	0x1f, 0x70, 0x1f, 0x9a, 0x1f, 0x89, 0x1f, 0x60, 0x07, 0x98, 0x1f, 0x8b,
-	0x7f, 0x70, 0x03, 0x97, 0x0f, 0x8c, 0xcd, 0x9c, 0x0f, 0x8e, 0xcb, 0x99,
-	0xc7, 0x92, 0xc9, 0x98, 0xc8, 0x97, 0x1f, 0x96, 0xc9, 0x99, 0x0f, 0x93,
-	0x3f, 0x06, 0x96, 0x1f, 0x92, 0x1f, 0x9f, 0x0f, 0x91, 0x0f, 0x9f, 0x0f,
-	0x90, 0x0f, 0xa1, 0x07, 0x8f, 0x0f, 0xa1, 0x07, 0x8f, 0x0f, 0xa1, 0x07,
-	0x8f, 0x0f, 0xa0, 0x0f, 0x90, 0x0f, 0xa0, 0x0f, 0x90, 0x0f, 0x9f, 0x1f,
-	0x92, 0x0f, 0x9e, 0x0f, 0x92, 0x1f, 0x9c, 0x1f, 0x95, 0x7f, 0x32, 0x8c,
-	0x69, 0x3f, 0x97, 0xe5, 0x9a, 0xe2, 0x9e, 0xde, 0xbf, 0xbf, 0xbf, 0xbf,
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x91
+	0xaa, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc3, 0xb9, 0xc4,
+	0xb9, 0xc5, 0xb8, 0xc6, 0xb7, 0xc7, 0xb7, 0xc7, 0xb5, 0x1e, 0xc2, 0xb5,
+	0x1e, 0xc3, 0xac, 0xcb, 0x82, 0xc4, 0xa9, 0xcd, 0x83, 0xc4, 0x60, 0x9f,
+	0xd0, 0x83, 0xca, 0x9e, 0xc6, 0x83, 0xc6, 0x84, 0xc9, 0x9d, 0xc4, 0x89,
+	0xc4, 0x85, 0xc7, 0x9c, 0xc4, 0x8b, 0xc4, 0x86, 0xc4, 0x9c, 0xc4, 0x8d,
+	0xc6, 0x83, 0xc4, 0x9c, 0xc3, 0x8f, 0xcd, 0x9c, 0xc3, 0x91, 0xcb, 0x99,
+	0xc7, 0x92, 0xc9, 0x98, 0xc8, 0x97, 0xc4, 0x98, 0xc9, 0x99, 0xc3, 0x96,
+	0xc2, 0x67, 0x9a, 0xc4, 0x94, 0xc4, 0xa1, 0xc3, 0x94, 0xc3, 0xa2, 0xc3,
+	0x93, 0xc3, 0xa4, 0xc2, 0x93, 0xc3, 0xa4, 0xc2, 0x93, 0xc3, 0xa4, 0xc2,
+	0x93, 0xc3, 0xa3, 0xc3, 0x93, 0xc3, 0xa3, 0xc3, 0x93, 0xc3, 0xa2, 0xc4,
+	0x94, 0xc3, 0xa1, 0xc3, 0x95, 0xc4, 0x9e, 0xc4, 0x97, 0xc5, 0x65, 0x8b,
+	0x24, 0xc7, 0x98, 0xe5, 0x9a, 0xe2, 0x9e, 0xde, 0x91, 0xbf, 0xbf, 0xbf,
+	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf
 };
 
 const char showers_icon[] PROGMEM = {
-	0xbf, 0xa6, 0x07, 0xb7, 0x0f, 0xb8, 0x0f, 0xb8, 0x0f, 0xb8, 0x0f, 0xac,
-	0x03, 0x60, 0x03, 0x60, 0xa2, 0x0f, 0x40, 0x07, 0x60, 0x03, 0x9d, 0x0f,
-	0x40, 0x01, 0x78, 0x01, 0x9c, 0x1f, 0x8f, 0x1f, 0xa2, 0x1f, 0x8d, 0x1f,
-	0xa4, 0x0f, 0x7c, 0x41, 0x07, 0xa4, 0x47, 0xc8, 0x38, 0xa3, 0x07, 0x78,
-	0xc7, 0xa5, 0xca, 0x7c, 0x7b, 0x03, 0x9d, 0xd2, 0x40, 0x0f, 0x9d, 0xd2,
-	0x88, 0x0f, 0x9b, 0x3f, 0x40, 0x1f, 0x87, 0x0f, 0x9a, 0x1f, 0x88, 0x1f,
-	0x87, 0x0f, 0x98, 0x1f, 0x8a, 0x1f, 0x00, 0x4f, 0x7f, 0x90, 0x1f, 0x8c,
-	0x7f, 0x40, 0x67, 0x3f, 0x8f, 0x0f, 0x8d, 0xc7, 0x70, 0x79, 0x0f, 0x8b,
-	0x1f, 0x90, 0xc7, 0x78, 0x94, 0xc8, 0x96, 0x1f, 0x07, 0x90, 0xc8, 0x98,
-	0xc8, 0x93, 0xc9, 0x99, 0x7f, 0x93, 0x1f, 0x9e, 0x3f, 0x91, 0x1f, 0xa0,
-	0x0f, 0x90, 0x0f, 0xa0, 0x4f, 0x90, 0x07, 0xa0, 0x6f, 0x01, 0x88, 0x0f,
-	0xa1, 0x6f, 0x03, 0x88, 0x0f, 0xa1, 0x67, 0x07, 0x88, 0x0f, 0xa1, 0x07,
-	0x0f, 0x89, 0x07, 0x8b, 0x01, 0x01, 0x40, 0x07, 0x1e, 0x89, 0x0f, 0x8a,
-	0x07, 0x07, 0x40, 0x0f, 0x38, 0x8a, 0x1f, 0x89, 0x0f, 0x0f, 0x40, 0x0f,
-	0x93, 0x1f, 0x88, 0x0f, 0x0f, 0x60, 0x07, 0x94, 0xcb, 0x38, 0x38, 0x7c,
-	0x1f, 0x98, 0xca, 0x3c, 0x3c, 0x7e, 0x0f, 0x9a, 0xc7, 0x38, 0x38, 0x7c,
-	0x07, 0xa5, 0x0f, 0x0f, 0xb1, 0x0f, 0x0f, 0xb0, 0x0f, 0x0e, 0xb1, 0x0f,
-	0x0f, 0xb1, 0x07, 0x07, 0xb1, 0x47, 0x07, 0xb1, 0x43, 0x07, 0xb6, 0x0f,
-	0xb8, 0x0f, 0xb8, 0x07, 0xb7, 0x0f, 0xb8, 0x0f, 0xb9, 0x03, 0xbf, 0xa2
+	0xa6, 0xbf, 0xc2, 0xbb, 0xc3, 0xbb, 0xc3, 0xbb, 0xc3, 0xbb, 0xc3, 0xaf,
+	0x03, 0x60, 0x03, 0x60, 0xa2, 0xc3, 0x88, 0xc3, 0x88, 0xc3, 0xa2, 0xc3,
+	0x88, 0xc1, 0x88, 0xc4, 0xa2, 0xc4, 0x91, 0xc4, 0xa4, 0xc4, 0x8f, 0xc4,
+	0xa5, 0x1e, 0x78, 0x03, 0xc3, 0xa7, 0x0e, 0xc8, 0x71, 0xa4, 0xc2, 0x86,
+	0xcb, 0xa5, 0xca, 0x81, 0xc6, 0x7e, 0xa2, 0xd2, 0x85, 0xc4, 0xa0, 0xd2,
+	0x88, 0xc3, 0x9e, 0xc5, 0x86, 0xc5, 0x89, 0xc3, 0x9d, 0xc4, 0x8a, 0xc4,
+	0x89, 0xc3, 0x9b, 0xc4, 0x8c, 0xc4, 0x87, 0x1e, 0xc7, 0x90, 0xc4, 0x8e,
+	0xc6, 0x84, 0x1e, 0xc7, 0x90, 0xc3, 0x90, 0xc7, 0x82, 0x1e, 0xc7, 0x8e,
+	0xc4, 0x92, 0xc7, 0x78, 0x94, 0xc8, 0x96, 0x1f, 0xc2, 0x94, 0xc8, 0x98,
+	0xc8, 0x93, 0xc9, 0x99, 0xc6, 0x93, 0xc4, 0xa0, 0xc5, 0x92, 0xc4, 0xa2,
+	0xc3, 0x93, 0xc3, 0xa3, 0x4f, 0x90, 0xc2, 0xa2, 0x3c, 0xc2, 0x8e, 0xc3,
+	0xa2, 0x3c, 0xc3, 0x8d, 0xc3, 0xa2, 0x1c, 0xc4, 0x8c, 0xc3, 0xa4, 0x07,
+	0xc3, 0x8c, 0xc2, 0x8f, 0x01, 0xc0, 0x8a, 0x1e, 0x78, 0x8b, 0xc3, 0x8d,
+	0x07, 0xc2, 0x89, 0x1f, 0x70, 0x8b, 0xc4, 0x8b, 0x0f, 0xc3, 0x88, 0xc4,
+	0x96, 0xc4, 0x8a, 0x0f, 0xc3, 0x87, 0xc4, 0x98, 0xca, 0x71, 0x70, 0x82,
+	0xc9, 0x9a, 0xc9, 0x79, 0x78, 0x81, 0xc9, 0x9d, 0xc6, 0x71, 0x70, 0x82,
+	0xc7, 0xa9, 0x0f, 0xc3, 0xb4, 0x0f, 0xc3, 0xb3, 0xc3, 0x70, 0xb4, 0x0f,
+	0xc3, 0xb4, 0x07, 0xc2, 0xb4, 0x0e, 0xc3, 0xb4, 0x06, 0xc3, 0xba, 0xc3,
+	0xbb, 0xc3, 0xbb, 0xc2, 0xbb, 0xc3, 0xbb, 0xc3, 0xbc, 0xc1, 0xa7, 0xbf
 };
 
 const char nt_showers_icon[] PROGMEM = {
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xab, 0x03, 0xb5, 0x1f, 0xb7, 0x3f,
-	0xb7, 0x3f, 0xb7, 0x7f, 0xb8, 0xc7, 0xb6, 0x6f, 0x03, 0xb1, 0x67, 0x03,
-	0xaa, 0x07, 0x47, 0x07, 0xa6, 0xcd, 0x78, 0x01, 0xa1, 0xcf, 0x70, 0x6f,
-	0x03, 0x99, 0xd1, 0x70, 0x7f, 0x9e, 0x3f, 0x40, 0x1f, 0x78, 0x1f, 0x9b,
-	0x1f, 0x88, 0x1f, 0x60, 0x0f, 0x99, 0x1f, 0x8b, 0x1f, 0x70, 0x01, 0x97,
-	0x0f, 0x8b, 0xc7, 0x7e, 0x9c, 0x0f, 0x8d, 0xcc, 0x9b, 0x3f, 0x90, 0xca,
-	0x98, 0xc8, 0x96, 0x3f, 0x97, 0xc9, 0x98, 0x0f, 0x94, 0xc9, 0x9a, 0x0f,
-	0x92, 0x1f, 0x9e, 0x0f, 0x92, 0x0f, 0x9f, 0x0f, 0x90, 0x0f, 0xa0, 0x0f,
-	0x90, 0x07, 0xa0, 0x0f, 0x90, 0x07, 0xa0, 0x0f, 0x90, 0x07, 0xa0, 0x0f,
-	0x90, 0x07, 0xa0, 0x0f, 0x90, 0x0f, 0x8b, 0x01, 0x01, 0x40, 0x07, 0x90,
-	0x0f, 0x8a, 0x07, 0x07, 0x00, 0x0f, 0x92, 0x0f, 0x89, 0x07, 0x07, 0x40,
-	0x07, 0x92, 0x1f, 0x88, 0x0f, 0x0f, 0x60, 0x0f, 0x94, 0xcb, 0x78, 0x78,
-	0x7c, 0x3f, 0x98, 0xca, 0x3c, 0x38, 0x7c, 0x0f, 0x9a, 0xc8, 0x3c, 0x3c,
-	0x7e, 0x07, 0xa5, 0x07, 0x07, 0xb0, 0x0f, 0x0f, 0xb1, 0x07, 0x0f, 0xb0,
-	0x0f, 0x0f, 0xb1, 0x0f, 0x0f, 0xb1, 0x07, 0x07, 0xb1, 0x47, 0x07, 0xb7,
-	0x0f, 0xb7, 0x0f, 0xb8, 0x0f, 0xb7, 0x0f, 0xb8, 0x0f, 0xb9, 0x03, 0x9c
+	0xab, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc1, 0xba, 0xc4, 0xb9, 0xc5,
+	0xb8, 0xc5, 0xb8, 0xc6, 0xb8, 0xc7, 0xb4, 0x3c, 0xc3, 0xb4, 0x1c, 0xc3,
+	0xae, 0x0e, 0x0e, 0xc3, 0xaa, 0xcd, 0x82, 0xc4, 0xa7, 0xcf, 0x83, 0xc4,
+	0x7b, 0x9e, 0xd1, 0x83, 0xc9, 0x9e, 0xc5, 0x86, 0xc5, 0x84, 0xc8, 0x9d,
+	0xc4, 0x8a, 0xc4, 0x86, 0xc5, 0x9c, 0xc4, 0x8d, 0xc4, 0x85, 0xc3, 0x9d,
+	0xc3, 0x8e, 0xc7, 0x7e, 0x9c, 0xc3, 0x90, 0xcc, 0x9b, 0xc5, 0x91, 0xca,
+	0x98, 0xc8, 0x96, 0xc5, 0x98, 0xc9, 0x98, 0xc3, 0x97, 0xc9, 0x9a, 0xc3,
+	0x95, 0xc4, 0xa0, 0xc3, 0x95, 0xc3, 0xa2, 0xc3, 0x93, 0xc3, 0xa3, 0xc3,
+	0x93, 0xc2, 0xa4, 0xc3, 0x93, 0xc2, 0xa4, 0xc3, 0x93, 0xc2, 0xa4, 0xc3,
+	0x93, 0xc2, 0xa4, 0xc3, 0x93, 0xc3, 0x8e, 0x01, 0xc0, 0x8b, 0xc3, 0x94,
+	0xc3, 0x8d, 0x07, 0xc2, 0x8a, 0xc3, 0x95, 0xc3, 0x8c, 0x07, 0xc2, 0x89,
+	0xc3, 0x96, 0xc4, 0x8a, 0x0f, 0xc3, 0x87, 0xc5, 0x97, 0xcb, 0x78, 0x78,
+	0x81, 0xca, 0x99, 0xc9, 0x79, 0x70, 0x82, 0xc8, 0x9d, 0xc7, 0x79, 0x78,
+	0x81, 0xc8, 0xa9, 0x07, 0xc2, 0xb4, 0x0f, 0xc3, 0xb4, 0x07, 0xc3, 0xb3,
+	0x0f, 0xc3, 0xb4, 0x0f, 0xc3, 0xb4, 0x07, 0xc2, 0xb4, 0x0e, 0xc3, 0xbb,
+	0xc3, 0xba, 0xc3, 0xbb, 0xc3, 0xba, 0xc3, 0xbb, 0xc3, 0xbc, 0xc1, 0xa1
 };
 
 const char rain_icon[] PROGMEM = {
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
-	0xbf, 0x9b, 0xc8, 0xb4, 0xcc, 0xb0, 0xd0, 0xad, 0x3f, 0x40, 0x1f, 0xa9,
-	0x1f, 0x88, 0x1f, 0xa7, 0x1f, 0x8a, 0x1f, 0xa6, 0x0f, 0x8b, 0x7f, 0xa4,
-	0x0f, 0x8d, 0xc7, 0xa1, 0x0f, 0x8f, 0xc7, 0x9c, 0xc7, 0x95, 0x3f, 0x98,
-	0xc9, 0x97, 0x1f, 0x95, 0xc9, 0x99, 0x1f, 0x93, 0x1f, 0x9e, 0x0f, 0x91,
-	0x1f, 0xa0, 0x07, 0x90, 0x0f, 0xa0, 0x07, 0x90, 0x07, 0xa0, 0x0f, 0x90,
-	0x07, 0xa0, 0x0f, 0x8f, 0x0f, 0xa1, 0x07, 0x90, 0x07, 0xa0, 0x07, 0x90,
-	0x07, 0x9f, 0x0f, 0x91, 0x0f, 0x00, 0x07, 0x07, 0x07, 0x70, 0x01, 0x8e,
-	0x1f, 0x00, 0x07, 0x07, 0x07, 0x78, 0x96, 0x1f, 0x60, 0x63, 0x63, 0x03,
-	0x3f, 0x96, 0xc7, 0x78, 0x78, 0x78, 0x7c, 0x07, 0x95, 0x7f, 0x3c, 0x3c,
-	0x38, 0x7c, 0x03, 0x96, 0x3f, 0x1e, 0x1e, 0x1e, 0x3f, 0x9f, 0x63, 0x61,
-	0x61, 0x71, 0xa7, 0x0f, 0x0f, 0x0f, 0xaa, 0x0f, 0x0f, 0x0f, 0xa9, 0x0f,
-	0x0f, 0x0e, 0xaa, 0x0f, 0x0f, 0x04, 0xaa, 0x07, 0x07, 0xb1, 0x47, 0x07,
-	0xb7, 0x07, 0xb7, 0x0f, 0xb8, 0x0f, 0xb8, 0x07, 0xb7, 0x0f, 0xb9, 0x03,
-	0xbf, 0xbf, 0x9f
+	0x9b, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf,
+	0xbf, 0xbf, 0xc8, 0xb4, 0xcc, 0xb0, 0xd0, 0xad, 0xc5, 0x86, 0xc5, 0xab,
+	0xc4, 0x8a, 0xc4, 0xa9, 0xc4, 0x8c, 0xc4, 0xa8, 0xc3, 0x8e, 0xc6, 0xa4,
+	0xc3, 0x90, 0xc7, 0xa1, 0xc3, 0x92, 0xc7, 0x9c, 0xc7, 0x95, 0xc5, 0x99,
+	0xc9, 0x97, 0xc4, 0x97, 0xc9, 0x99, 0xc4, 0x95, 0xc4, 0xa0, 0xc3, 0x94,
+	0xc4, 0xa2, 0xc2, 0x94, 0xc3, 0xa3, 0xc2, 0x94, 0xc2, 0xa4, 0xc3, 0x93,
+	0xc2, 0xa4, 0xc3, 0x92, 0xc3, 0xa4, 0xc2, 0x94, 0xc2, 0xa4, 0xc2, 0x94,
+	0xc2, 0xa3, 0xc3, 0x94, 0xc3, 0x89, 0x07, 0x07, 0xc2, 0x87, 0xc3, 0x94,
+	0xc4, 0x88, 0x07, 0x07, 0x07, 0x78, 0x96, 0x1f, 0x60, 0x63, 0x63, 0x03,
+	0xc5, 0x97, 0xc7, 0x78, 0x78, 0x78, 0x81, 0xc7, 0x99, 0xc5, 0x79, 0x78,
+	0x70, 0x82, 0xc6, 0x9b, 0x3f, 0x1e, 0x1e, 0x1e, 0xc5, 0xa0, 0x63, 0x61,
+	0x61, 0x71, 0xa7, 0x0f, 0x0f, 0xc3, 0xad, 0x0f, 0x0f, 0xc3, 0xac, 0x0f,
+	0xc3, 0x70, 0xad, 0x0f, 0xc2, 0x41, 0xae, 0x07, 0xc2, 0xb4, 0x0e, 0xc3,
+	0xbb, 0xc2, 0xbb, 0xc3, 0xbb, 0xc3, 0xbb, 0xc2, 0xbb, 0xc3, 0xbc, 0xc1,
+	0xa4, 0xbf, 0xbf
 };
 
 const char tstorms_icon[] PROGMEM = {
-	0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0x9e, 0x07,
-	0xb4, 0xca, 0xb2, 0xce, 0xaf, 0xd0, 0xad, 0x3f, 0x40, 0x1f, 0xa9, 0x1f,
-	0x88, 0x1f, 0xa7, 0x0f, 0x8a, 0x1f, 0xa5, 0x1f, 0x8c, 0x7f, 0xa4, 0x0f,
-	0x8d, 0xc7, 0x9f, 0x3f, 0x91, 0xc7, 0x9b, 0xc8, 0x96, 0x1f, 0x97, 0xc8,
-	0x98, 0x1f, 0x95, 0xc9, 0x99, 0x1f, 0x93, 0x1f, 0x9e, 0x0f, 0x91, 0x1f,
-	0x9f, 0x0f, 0x91, 0x0f, 0xa0, 0x07, 0x8f, 0x0f, 0xa1, 0x0f, 0x8f, 0x0f,
-	0xa1, 0x0f, 0x8f, 0x0f, 0xa1, 0x07, 0x8f, 0x0f, 0xa1, 0x07, 0x8f, 0x0f,
-	0x88, 0x01, 0x61, 0x03, 0x78, 0x94, 0x0f, 0x00, 0x07, 0x47, 0x07, 0x78,
-	0x01, 0x8e, 0x1f, 0x40, 0x07, 0x47, 0x07, 0x7c, 0x96, 0x1f, 0x60, 0x63,
-	0x73, 0x03, 0x1f, 0x96, 0xc7, 0x38, 0x38, 0x3c, 0x70, 0x03, 0x95, 0x7f,
-	0x3c, 0x3c, 0x3c, 0x70, 0x01, 0x96, 0x1f, 0x1e, 0x1e, 0x0e, 0x3c, 0xa3,
-	0x0f, 0x0e, 0x3e, 0xaa, 0x0f, 0x0f, 0x3e, 0xaa, 0x07, 0x07, 0x3f, 0xa9,
-	0x0f, 0x0f, 0x3e, 0xaa, 0x07, 0x0f, 0x38, 0xaa, 0x47, 0x07, 0x18, 0xaa,
-	0x43, 0x07, 0x18, 0xb0, 0x07, 0x30, 0xb0, 0x0f, 0x20, 0xb1, 0x0f, 0x20,
-	0xb0, 0x0f, 0xb8, 0x0f, 0xb9, 0x03, 0xbf, 0xbf, 0xbf, 0xbf, 0x9f
+	0x9e, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xbf, 0xc2,
+	0xb8, 0xca, 0xb2, 0xce, 0xaf, 0xd0, 0xad, 0xc5, 0x86, 0xc5, 0xab, 0xc4,
+	0x8a, 0xc4, 0xa9, 0xc3, 0x8d, 0xc4, 0xa7, 0xc4, 0x8e, 0xc6, 0xa4, 0xc3,
+	0x90, 0xc7, 0x9f, 0xc5, 0x92, 0xc7, 0x9b, 0xc8, 0x96, 0xc4, 0x99, 0xc8,
+	0x98, 0xc4, 0x97, 0xc9, 0x99, 0xc4, 0x95, 0xc4, 0xa0, 0xc3, 0x94, 0xc4,
+	0xa1, 0xc3, 0x94, 0xc3, 0xa3, 0xc2, 0x93, 0xc3, 0xa4, 0xc3, 0x92, 0xc3,
+	0xa4, 0xc3, 0x92, 0xc3, 0xa4, 0xc2, 0x93, 0xc3, 0xa4, 0xc2, 0x93, 0xc3,
+	0x8b, 0x01, 0x61, 0x03, 0x78, 0x94, 0xc3, 0x88, 0x0e, 0x0e, 0xc3, 0x86,
+	0xc4, 0x94, 0x1f, 0x40, 0x07, 0x47, 0x07, 0x7c, 0x96, 0xc4, 0x86, 0x0f,
+	0x4f, 0x0f, 0x7c, 0x98, 0xc6, 0x71, 0x70, 0x78, 0x84, 0xc4, 0x9a, 0xc5,
+	0x79, 0x78, 0x78, 0x84, 0xc3, 0x9b, 0x3e, 0x3c, 0x3c, 0x1c, 0x78, 0xa3,
+	0x1e, 0x1c, 0x7c, 0xaa, 0x1e, 0x1e, 0x7c, 0xab, 0x07, 0x07, 0xc5, 0xa9,
+	0x1e, 0x1e, 0x7c, 0xaa, 0x0e, 0x1e, 0x70, 0xa9, 0x1c, 0x1e, 0x60, 0xaa,
+	0x0c, 0x1e, 0x60, 0xb1, 0x0e, 0x60, 0xb0, 0x1e, 0x40, 0xb1, 0x1e, 0x40,
+	0xb1, 0xc3, 0xbb, 0xc3, 0xbc, 0xc1, 0xa4, 0xbf, 0xbf, 0xbf, 0xbf
 };
 
 
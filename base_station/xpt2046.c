@@ -14,10 +14,10 @@
 #include <avr/io.h>
 #include <avr/eeprom.h>
 #include "xpt2046.h"
+#include "nvram.h"
 
 uint16_t ts_x, ts_y;
 uint16_t ts_xMin, ts_xMax, ts_yMin, ts_yMax;
-uint16_t EEMEM nv_xMin, nv_xMax, nv_yMin, nv_yMax;
 
 #define map(x,in_min,in_max,out_min,out_max) (((x)-(in_min))*((out_max)-(out_min))/((in_max)-(in_min))+(out_min))
 #define min(a,b) ((a)<(b)?(a):(b))
@@ -51,10 +51,10 @@ void xpt2046_init(void) {
 	spi_transfer(CTRL_HI_Y | CTRL_LO_SER);
 	spi_transfer16(0);  // Flush, just to be sure
 	spi_end();
-	ts_xMin = eeprom_read_word(&nv_xMin);
-	ts_xMax = eeprom_read_word(&nv_xMax);
-	ts_yMin = eeprom_read_word(&nv_yMin);
-	ts_yMax = eeprom_read_word(&nv_yMax);
+	ts_xMin = eeprom_read_word(&nv.xMin);
+	ts_xMax = eeprom_read_word(&nv.xMax);
+	ts_yMin = eeprom_read_word(&nv.yMin);
+	ts_yMax = eeprom_read_word(&nv.yMax);
 }
 
 uint16_t _readLoop(uint8_t ctrl, uint8_t max_samples) {
@@ -99,10 +99,10 @@ void xpt2046_getPosition(uint8_t max_samples, uint8_t rotation) {
 	ts_xMax = max(vi, ts_xMax);
 	ts_yMin = min(vj, ts_yMin);
 	ts_yMax = max(vj, ts_yMax);
-	eeprom_update_word(&nv_xMin, ts_xMin);
-	eeprom_update_word(&nv_xMax, ts_xMax);
-	eeprom_update_word(&nv_yMin, ts_yMin);
-	eeprom_update_word(&nv_yMax, ts_yMax);
+	eeprom_update_word(&nv.xMin, ts_xMin);
+	eeprom_update_word(&nv.xMax, ts_xMax);
+	eeprom_update_word(&nv.yMin, ts_yMin);
+	eeprom_update_word(&nv.yMax, ts_yMax);
 
 	ts_x = map((int32_t)vi, ts_xMin, ts_xMax, 0, LCD_WIDTH - 1);
 	ts_y = map((int32_t)vj, ts_yMin, ts_yMax, 0, LCD_HEIGHT - 1);
@@ -0,0 +1,66 @@
+/*
+ * EEPROM host backend
+ *
+ * Created: 17-10-2026 09:12:40
+ *
+ * Counts writes per address in a table of the addresses written so far, the
+ * 1 KB of the ATmega328P fits.
+ */
+
+#include <string.h>
+#include "eepromhost.h"
+
+#define MAX_CELLS 1024
+
+bool eepromhost_busy;
+eepromhost_cost_t eepromhost_cost;
+
+static struct {
+	const uint8_t *p;
+	uint32_t writes;
+} cells[MAX_CELLS];
+static uint16_t cell_count;
+
+static void access(void) {
+	if (eepromhost_busy) eepromhost_cost.waits++;
+	eepromhost_busy = false;
+}
+
+uint8_t eeprom_read_byte(const uint8_t *p) {
+	access();
+	return *p;
+}
+
+uint32_t eeprom_read_dword(const uint32_t *p) {
+	uint32_t value;
+	eeprom_read_block(&value, p, sizeof(value));
+	return value;
+}
+
+void eeprom_read_block(void *dst, const void *src, size_t n) {
+	access();
+	memcpy(dst, src, n);
+}
+
+void eeprom_write_byte(uint8_t *p, uint8_t value) {
+	uint16_t i;
+	access();
+	*p = value;
+	eepromhost_busy = true;
+	eepromhost_cost.writes++;
+	for (i = 0; i < cell_count && cells[i].p != p; i++);
+	if (i == cell_count && cell_count < MAX_CELLS) cells[cell_count++].p = p;
+	if (i < cell_count && ++cells[i].writes > eepromhost_cost.max_writes)
+		eepromhost_cost.max_writes = cells[i].writes;
+}
+
+// Complete write in progress, as if enough time has passed
+void eepromhost_finish(void) {
+	eepromhost_busy = false;
+}
+
+void eepromhost_resetCost(void) {
+	memset(&eepromhost_cost, 0, sizeof(eepromhost_cost));
+	memset(cells, 0, sizeof(cells));
+	cell_count = 0;
+}
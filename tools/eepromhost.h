@@ -0,0 +1,42 @@
+/*
+ * EEPROM host backend
+ *
+ * Created: 17-10-2026 09:12:40
+ *
+ * Stands in for avr/eeprom.h when modules of the base station are built on
+ * a PC. EEMEM variables are plain memory. A write keeps the EEPROM busy until
+ * eepromhost_finish() is called, like the 3.4 ms a write takes on the AVR,
+ * and every access that would wait for it is counted. Writes are counted per
+ * address to estimate wear.
+ *
+ * gcc -O2 -I. -o prog prog.c ../base_station/module.c eepromhost.c
+ */
+
+
+#ifndef EEPROMHOST_H_
+#define EEPROMHOST_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define EEMEM
+#define eeprom_is_ready() (!eepromhost_busy)
+
+typedef struct {
+	uint32_t writes;	// bytes written
+	uint32_t waits;		// accesses while a write was in progress
+	uint32_t max_writes;	// most writes to one address
+} eepromhost_cost_t;
+
+extern bool eepromhost_busy;
+extern eepromhost_cost_t eepromhost_cost;
+
+uint8_t eeprom_read_byte(const uint8_t *p);
+uint32_t eeprom_read_dword(const uint32_t *p);
+void eeprom_read_block(void *dst, const void *src, size_t n);
+void eeprom_write_byte(uint8_t *p, uint8_t value);
+void eepromhost_finish(void);
+void eepromhost_resetCost(void);
+
+#endif /* EEPROMHOST_H_ */
@@ -0,0 +1,57 @@
+/*
+ * Font index generator
+ *
+ * Created: 16-10-2026 10:12:40
+ *
+ * Emits a glyph offset table for every proportional openGLCD font, so the
+ * ILI9341 driver can locate a character without summing the widths of all
+ * preceding characters. Run on the host after adding or changing a font:
+ *
+ * gcc -o fontindex fontindex.c && ./fontindex > ../base_station/fonts/fontIndex.h
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "../base_station/fonts/allFonts.h"
+
+#define FONT(f) {#f, f}
+
+static const struct {
+	const char *name;
+	const uint8_t *font;
+} fonts[] = {
+	FONT(System5x7), FONT(Iain5x7), FONT(Arial14), FONT(Arial_bold_14),
+	FONT(Corsiva_12), FONT(Verdana_digits_24), FONT(fixednums7x15),
+	FONT(fixednums8x16), FONT(fixednums15x31), FONT(CalBlk36), FONT(CalLite24),
+	FONT(lcdnums12x16), FONT(lcdnums14x24), FONT(fixed_bold10x15),
+	FONT(Wendy3x5), FONT(newbasic3x5), FONT(font8x8), FONT(cp437font8x8)
+};
+
+int main(void) {
+	puts("/*\n"
+		" * Glyph offset tables for proportional fonts\n"
+		" * Generated by tools/fontindex.c, do not edit\n"
+		" *\n"
+		" * Every entry is the big endian offset of the character data from the\n"
+		" * start of the font. Pass it to ili9341_setFontIndex() with the font.\n"
+		" */\n\n"
+		"#ifndef _fontIndex_h_\n"
+		"#define _fontIndex_h_\n");
+	for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+		const uint8_t *font = fonts[f].font;
+		// fixed width fonts have a size of zero or one
+		if (font[FONT_LENGTH] == 0 && font[FONT_LENGTH+1] < 2) continue;
+		uint8_t bytes = (font[FONT_HEIGHT] + 7) / 8;
+		uint8_t count = font[FONT_CHAR_COUNT];
+		uint16_t offset = FONT_WIDTH_TABLE + count;
+		printf("GLCDFONTDECL(%s_index) = {", fonts[f].name);
+		for (uint8_t c = 0; c < count; c++) {
+			printf((c % 8) ? " " : "\n\t");
+			printf("0x%02X, 0x%02X,", offset >> 8, offset & 0xFF);
+			offset += bytes * font[FONT_WIDTH_TABLE + c];
+		}
+		printf("\n};\n\n");
+	}
+	puts("#endif");
+	return 0;
+}
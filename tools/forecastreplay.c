@@ -0,0 +1,170 @@
+/*
+ * Forecast replay
+ *
+ * Created: 16-10-2026 23:20:37
+ *
+ * Streams a log of barometric readings through the forecast module of the
+ * base station and reports how often each forecast letter and trend occurs,
+ * how long the trend takes to follow a change of the actual pressure
+ * tendency and how fast the replay ran. Without a log, synthetic weather is
+ * generated for the given number of days.
+ *
+ * gcc -O2 -o forecastreplay forecastreplay.c ../base_station/forecast.c -lm
+ * ./forecastreplay [-a altitude] log.csv
+ * ./forecastreplay [-a altitude] -g days
+ *
+ * Log lines: unix time, station pressure in Pa, temperature in degrees C,
+ * month 1-12, N or S. Readings are taken once per minute like on the base
+ * station, lines that do not start with a number are skipped.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "../base_station/forecast.h"
+
+#define REFERENCE_MINUTES 60 // actual tendency is the change over the last hour
+
+typedef struct {
+	int64_t time;
+	uint32_t pressure;
+	int8_t temperature;
+	int8_t month;		// 0-11
+	bool north;
+} record_t;
+
+static record_t *records;
+static size_t record_count, record_size;
+
+static void addRecord(record_t *r) {
+	if (record_count == record_size) {
+		record_size = (record_size) ? record_size * 2 : 4096;
+		records = realloc(records, record_size * sizeof(record_t));
+		if (!records) {
+			fprintf(stderr, "Out of memory\n");
+			exit(2);
+		}
+	}
+	records[record_count++] = *r;
+}
+
+static bool readLog(const char *filename) {
+	char line[256];
+	FILE *f = (strcmp(filename, "-")) ? fopen(filename, "r") : stdin;
+	if (!f) return false;
+	while (fgets(line, sizeof(line), f)) {
+		record_t r;
+		long long time;
+		double temperature;
+		int month;
+		char hemisphere;
+		if (sscanf(line, "%lld ,%u ,%lf ,%d ,%c", &time, &r.pressure, &temperature, &month, &hemisphere) != 5)
+			continue;
+		r.time = time;
+		r.temperature = lround(temperature);
+		r.month = (month - 1) % 12;
+		r.north = hemisphere != 'S' && hemisphere != 's';
+		addRecord(&r);
+	}
+	if (f != stdin) fclose(f);
+	return true;
+}
+
+// Slow highs and lows with faster fronts on top and some sensor noise
+static void generate(long days) {
+	uint32_t seed = 1;
+	for (long m = 0; m < days * 1440; m++) {
+		record_t r;
+		double day = m / 1440.0;
+		seed = seed * 1103515245 + 12345;
+		r.time = 1735689600 + m * 60;
+		r.pressure = 97500 + 1200 * sin(2 * M_PI * day / 6.0) + 400 * sin(2 * M_PI * day / 1.7) + (int)((seed >> 16) % 7) - 3;
+		r.temperature = 10 + 8 * sin(2 * M_PI * day);
+		r.month = (int)(day / 30.5) % 12;
+		r.north = true;
+		addRecord(&r);
+	}
+}
+
+static int8_t tendency(int32_t trend) {
+	return (trend > FORECAST_THRESHOLD) ? 1 : (trend < -FORECAST_THRESHOLD) ? -1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+	static uint32_t history[REFERENCE_MINUTES];
+	static uint64_t letters[26], trends[3];
+	uint64_t minutes = 0, gaps = 0, changes = 0, matched = 0, missed = 0, latency = 0, max_latency = 0, pending_start = 0;
+	int16_t altitude = 0;
+	long days = 0;
+	int8_t actual = 0, pending = 2;
+	int i;
+
+	for (i = 1; i < argc - 1 && argv[i][0] == '-' && argv[i][1]; i += 2) {
+		if (!strcmp(argv[i], "-a")) altitude = atoi(argv[i + 1]);
+		else if (!strcmp(argv[i], "-g")) days = atol(argv[i + 1]);
+		else break;
+	}
+	if ((days > 0) ? i != argc : i != argc - 1) {
+		fprintf(stderr, "Usage: %s [-a altitude] log.csv|-\n       %s [-a altitude] -g days\n", argv[0], argv[0]);
+		return 2;
+	}
+	if (days > 0) {
+		generate(days);
+	} else if (!readLog(argv[i])) {
+		fprintf(stderr, "Cannot read %s\n", argv[i]);
+		return 2;
+	}
+
+	forecast_init();
+	clock_t start = clock();
+	for (size_t n = 0; n < record_count; n++) {
+		record_t *r = &records[n];
+		// one sample per minute like the base station
+		if (n && r->time / 60 == records[n - 1].time / 60) continue;
+		if (n && r->time - records[n - 1].time > 90) gaps++;
+		forecast_sample(r->pressure);
+		char z = forecast_zambretti(forecast_seaLevel(r->pressure, r->temperature, altitude), r->month, r->north);
+		letters[z - 'A']++;
+		int8_t estimated = tendency(forecast_trend);
+		trends[estimated + 1]++;
+		// actual tendency from the change of pressure over the last hour
+		uint32_t *old = &history[minutes % REFERENCE_MINUTES];
+		if (minutes >= REFERENCE_MINUTES) {
+			int8_t now = tendency(((int32_t)(r->pressure - *old)) * 60 / REFERENCE_MINUTES);
+			if (now != actual) {
+				actual = now;
+				changes++;
+				if (pending != 2) missed++;
+				pending = now;
+				pending_start = minutes;
+			}
+		}
+		*old = r->pressure;
+		if (pending != 2 && estimated == pending) {
+			uint64_t delay = minutes - pending_start;
+			latency += delay;
+			if (delay > max_latency) max_latency = delay;
+			matched++;
+			pending = 2;
+		}
+		minutes++;
+	}
+	double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("records %zu, minutes %llu, gaps %llu\n", record_count, (unsigned long long)minutes, (unsigned long long)gaps);
+	printf("replay %.3f s, %.1f M samples/s\n", seconds, (seconds > 0) ? minutes / seconds / 1e6 : 0);
+	if (!minutes) return 1;
+	printf("trend    falling %5.1f%%  steady %5.1f%%  rising %5.1f%%\n", 100.0 * trends[0] / minutes,
+		100.0 * trends[1] / minutes, 100.0 * trends[2] / minutes);
+	printf("latency  %llu changes, %llu followed, mean %.0f min, max %llu min, %llu missed\n",
+		(unsigned long long)changes, (unsigned long long)matched, (matched) ? (double)latency / matched : 0,
+		(unsigned long long)max_latency, (unsigned long long)missed);
+	for (uint8_t z = 0; z < 26; z++) {
+		if (letters[z])
+			printf("forecast %c %10llu %5.1f%%\n", 'A' + z, (unsigned long long)letters[z], 100.0 * letters[z] / minutes);
+	}
+	return 0;
+}
@@ -0,0 +1,229 @@
+/*
+ * Sensor history check
+ *
+ * Created: 17-10-2026 09:40:05
+ *
+ * Stores a year of simulated sensor readings in the history module of the
+ * base station on emulated EEPROM, with gaps, power losses between samples
+ * and power losses while a sample is being stored. After every sample all
+ * series are read back with the iterator and compared with the readings,
+ * which tests the encoding, the anchors and the stamps. The EEPROM starts
+ * with random contents, as left by older firmware. Fails on a sample that is
+ * off by more than half a step, or more than the clamped change can catch
+ * up, on a sample that appears or disappears, on a call that writes more
+ * than one byte or touches a busy EEPROM, and when a cell would wear out
+ * within 20 years.
+ *
+ * gcc -O2 -I. -o historycheck historycheck.c ../base_station/history.c eepromhost.c
+ * ./historycheck [days]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "eepromhost.h"
+#include "../base_station/nvram.h"
+
+#define FIRST_SEQ 455000	// 2026
+#define ENDURANCE 100000	// write cycles of an EEPROM cell
+#define MIN_YEARS 20
+#define JUMPING 2		// series with sudden changes beyond the clamp
+#define FLAKY 4			// series that misses readings
+#define LATE 5			// series that is enabled later
+#define LATE_SEQ (FIRST_SEQ + 1000)
+#define REMOTES 6		// other remote series never report
+#define MAX_REPORTS 10
+
+typedef struct {
+	bool valid;
+	int16_t temp;
+	uint16_t humid;
+} reading_t;
+
+nvram_t nv;
+static reading_t truth[HISTORY_SAMPLES][HISTORY_SERIES], sensor[HISTORY_SERIES];
+static uint32_t stored[HISTORY_SAMPLES];	// sample number in slot
+static uint32_t dropped = HISTORY_NONE;	// sample that may be gone after a power loss
+static uint32_t seed = 1, errors;
+
+static int32_t rnd(int32_t min, int32_t max) {
+	seed = seed * 1103515245 + 12345;
+	return min + (int32_t)((seed >> 8) % (uint32_t)(max - min + 1));
+}
+
+static void error(const char *text, uint32_t seq, uint8_t series) {
+	if (errors++ < MAX_REPORTS) printf("sample %u series %u: %s\n", seq, series, text);
+}
+
+// next reading of every series, changes stay within the clamp unless jumping
+static void readSensors(uint32_t seq) {
+	for (uint8_t s = 0; s < HISTORY_SERIES; s++) {
+		reading_t *r = &sensor[s];
+		bool remote = s < HISTORY_SERIES - 1;
+		if (remote && s >= REMOTES) continue;
+		if (s < JUMPING && rnd(0, 99) == 0) {
+			r->temp += rnd(-80, 80);
+			r->humid += rnd(-300, 300);
+		} else {
+			r->temp += rnd(-6, 6);
+			r->humid += rnd(-30, 30);
+		}
+		if (r->temp < -400) r->temp = -400;
+		if (r->temp > 850) r->temp = 850;
+		if ((int16_t)r->humid < 0 || r->humid > 60000) r->humid = 0;
+		if (r->humid > 1000) r->humid = 1000;
+		r->valid = (s == FLAKY) ? rnd(0, 9) < 7 : (s == LATE) ? seq >= LATE_SEQ : true;
+	}
+}
+
+// call until done like serviceHistory, returns false when power was lost after cut calls
+static bool store(uint32_t seq, long cut) {
+	uint8_t i = 0xFF;
+	long calls = 0;
+	while (true) {
+		uint32_t writes = eepromhost_cost.writes;
+		bool done;
+		if (calls++ == cut) return false;
+		if (i == 0xFF)
+			done = history_begin(seq);
+		else if (i < HISTORY_SERIES)
+			done = history_append(i, sensor[i].valid, sensor[i].temp, sensor[i].humid);
+		else
+			done = history_commit();
+		if (eepromhost_cost.writes - writes > 1) error("more than one write per call", seq, i);
+		// the main loop runs other tasks, often before the write is finished
+		if (rnd(0, 1)) eepromhost_finish();
+		if (!done) continue;
+		if (i == HISTORY_SERIES) break;
+		i = (i == 0xFF) ? 0 : i + 1;
+	}
+	for (uint8_t s = 0; s < HISTORY_SERIES; s++)
+		truth[seq % HISTORY_SAMPLES][s] = sensor[s];
+	stored[seq % HISTORY_SAMPLES] = seq;
+	return true;
+}
+
+// clamped changes are caught up with by 7 steps per sample
+static bool offBy(int32_t error, int32_t limit, int32_t last_error, int32_t change, uint8_t step) {
+	return error > limit && error > last_error + change - 7 * step;
+}
+
+// read back every series and compare with the readings, oldest first
+static void verify(void) {
+	if (history_newest == HISTORY_NONE) {
+		for (uint8_t i = 0; i < HISTORY_SAMPLES; i++) {
+			if (stored[i] != HISTORY_NONE) error("history lost", stored[i], 0);
+		}
+		return;
+	}
+	for (uint8_t s = 0; s < HISTORY_SERIES; s++) {
+		history_iter_t list[HISTORY_SAMPLES], it;
+		uint8_t count = 0;
+		bool seen = false, missed = false;
+		int32_t last_temp_error = 0, last_humid_error = 0;
+		reading_t last = {0};
+		if (history_first(&it, s)) {
+			do list[count++] = it; while (history_next(&it));
+		}
+		if (count && count != HISTORY_SAMPLES) error("iterator length", it.seq, s);
+		for (int8_t k = count - 1; k >= 0; k--) {
+			history_iter_t *h = &list[k];
+			uint8_t slot = h->seq % HISTORY_SAMPLES;
+			reading_t *r = &truth[slot][s];
+			bool expected = stored[slot] == h->seq && r->valid;
+			if (h->valid && !expected) error("sample without reading", h->seq, s);
+			// a series without value gets one with the anchor of the next sample, if it reports then
+			if (!h->valid && expected && h->seq != dropped && (seen || missed))
+				error("reading without sample", h->seq, s);
+			missed = !h->valid && expected;
+			if (!h->valid || !expected) continue;
+			int32_t temp_error = abs(h->temp - r->temp), humid_error = abs(h->humid - r->humid);
+			// humidity is not rounded below zero
+			int32_t humid_limit = (r->humid < HISTORY_HUMID_STEP) ? HISTORY_HUMID_STEP - 1 : HISTORY_HUMID_STEP / 2;
+			// without clamped changes every value is within half a step
+			if (s >= JUMPING && s != FLAKY && (temp_error > HISTORY_TEMP_STEP / 2 || humid_error > humid_limit))
+				error("value off", h->seq, s);
+			if (seen && (offBy(temp_error, HISTORY_TEMP_STEP / 2, last_temp_error, abs(r->temp - last.temp), HISTORY_TEMP_STEP) ||
+				offBy(humid_error, humid_limit, last_humid_error, abs(r->humid - last.humid), HISTORY_HUMID_STEP)))
+				error("value not caught up", h->seq, s);
+			last_temp_error = temp_error;
+			last_humid_error = humid_error;
+			seen = true;
+			last = *r;
+		}
+		if (count && list[0].seq != history_newest) error("iterator does not start at newest sample", list[0].seq, s);
+	}
+}
+
+int main(int argc, char *argv[]) {
+	long days = (argc > 1) ? atol(argv[1]) : 365;
+	long gaps = 0, restarts = 0, cuts = 0, lost = 0, samples = 0;
+	uint32_t seq = FIRST_SEQ, end = FIRST_SEQ + days * 24 * 60 / HISTORY_INTERVAL;
+
+	for (uint8_t i = 0; i < HISTORY_SAMPLES; i++)
+		stored[i] = HISTORY_NONE;
+	for (uint8_t s = 0; s < HISTORY_SERIES; s++) {
+		sensor[s].temp = rnd(-100, 300);
+		sensor[s].humid = rnd(200, 900);
+	}
+	// EEPROM of older firmware holds anything after the calibration, at worst a history
+	for (uint16_t i = 0; i < sizeof(nv.history); i++)
+		((uint8_t *)&nv.history)[i] = rnd(0, 255);
+	nv.history.seq = FIRST_SEQ - 1;
+	nv.history.stamp[(FIRST_SEQ - 1) % HISTORY_SAMPLES] = (uint8_t)((FIRST_SEQ - 1) / HISTORY_SAMPLES);
+	history_clear();
+	eepromhost_finish();
+	history_init();
+	if (history_newest != HISTORY_NONE) error("history after clear", history_newest, 0);
+	eepromhost_resetCost();
+	for (; seq < end; seq++) {
+		readSensors(seq);
+		if (rnd(0, 199) == 0) {
+			// outage, sometimes longer than the history
+			seq += rnd(1, 60);
+			gaps++;
+		}
+		if (rnd(0, 99) == 0) {
+			eepromhost_finish();
+			history_init();
+			restarts++;
+		}
+		if (rnd(0, 99) == 0) {
+			uint32_t newest = history_newest;
+			cuts++;
+			if (!store(seq, rnd(0, 40))) {
+				eepromhost_finish();
+				history_init();
+				// the slot of the oldest sample was being overwritten
+				dropped = seq - HISTORY_SAMPLES;
+				if (history_newest == HISTORY_NONE && newest != HISTORY_NONE) {
+					for (uint8_t i = 0; i < HISTORY_SAMPLES; i++)
+						stored[i] = HISTORY_NONE;
+					lost++;
+				} else if (history_newest != newest) {
+					error("newest sample changed by power loss", seq, 0);
+				}
+				eepromhost_finish();
+				verify();
+				continue;
+			}
+		} else {
+			store(seq, -1);
+		}
+		samples++;
+		eepromhost_finish();
+		verify();
+	}
+
+	double years = days / 365.0;
+	double life = (eepromhost_cost.max_writes) ? ENDURANCE * years / eepromhost_cost.max_writes : 0;
+	printf("%ld samples in %ld days, %ld outages, %ld restarts, %ld power losses while storing, %ld histories lost\n",
+		samples, days, gaps, restarts, cuts, lost);
+	printf("%u writes, %.1f per sample, most writes to a cell %u, %.0f years to %u writes\n", eepromhost_cost.writes,
+		(double)eepromhost_cost.writes / samples, eepromhost_cost.max_writes, life, ENDURANCE);
+	printf("%u accesses to a busy EEPROM, %u errors\n", eepromhost_cost.waits, errors);
+	if (days >= 365 && life < MIN_YEARS) {
+		printf("FAIL wear\n");
+		return 1;
+	}
+	return errors || eepromhost_cost.waits;
+}
@@ -0,0 +1,259 @@
+/*
+ * ILI9341 driver benchmark
+ *
+ * Created: 16-10-2026 15:02:27
+ *
+ * Draws every primitive of the ILI9341 driver on the host backend and prints
+ * the SPI bytes, address windows, spiwrite16 calls, estimated cycles and a
+ * checksum of the screen for each. When the baseline file of an earlier run
+ * is given, the run fails if a primitive got slower than the threshold allows
+ * or if its output changed.
+ *
+ * gcc -O2 -I. -o ili9341bench ili9341bench.c ../base_station/ili9341.c ili9341host.c
+ * ./ili9341bench ili9341bench.txt
+ * ./ili9341bench > ili9341bench.txt (after an intended change)
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "ili9341host.h"
+#include "../base_station/ili9341.h"
+#include "../base_station/weatherIcons.h"
+
+#define F_CPU_MHZ 12
+#define THRESHOLD 2 // allowed cycle increase in percent
+#define MAX_RESULTS 64
+
+#define FONT(f) {#f, f, NULL}
+#define FONT_INDEX(f) {#f, f, f##_index}
+
+static const struct {
+	const char *name;
+	const uint8_t *font, *index;
+} fonts[] = {
+	FONT(System5x7), FONT_INDEX(Iain5x7), FONT_INDEX(Arial14), FONT_INDEX(Arial_bold_14),
+	FONT_INDEX(Corsiva_12), FONT_INDEX(Verdana_digits_24), FONT(fixednums7x15),
+	FONT(fixednums8x16), FONT(fixednums15x31), FONT_INDEX(CalBlk36), FONT_INDEX(CalLite24),
+	FONT(lcdnums12x16), FONT(lcdnums14x24), FONT(fixed_bold10x15),
+	FONT(Wendy3x5), FONT(newbasic3x5), FONT(font8x8), FONT(cp437font8x8)
+};
+#define ARIAL_BOLD_14 3 // index in fonts
+#define LCDNUMS14X24 12
+
+// 16x16 XBM, circle with cross
+static const char xbm[] PROGMEM = {
+	0xe0, 0x07, 0x18, 0x18, 0x84, 0x21, 0x82, 0x41, 0x82, 0x41, 0x81, 0x81,
+	0x81, 0x81, 0xff, 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x81, 0x82, 0x41,
+	0x82, 0x41, 0x84, 0x21, 0x18, 0x18, 0xe0, 0x07
+};
+
+typedef struct {
+	char name[32];
+	uint32_t bytes, windows, writes, cycles, crc;
+} result_t;
+
+static result_t baseline[MAX_RESULTS];
+static uint8_t baseline_count;
+static bool failed;
+
+// FNV-1a hash of the screen
+static uint32_t screenCrc(void) {
+	uint32_t crc = 2166136261u;
+	for (uint16_t y = 0; y < 240; y++) {
+		for (uint16_t x = 0; x < 320; x++) {
+			uint16_t color = ili9341host_pixel(x, y);
+			crc = (crc ^ (color & 0xFF)) * 16777619u;
+			crc = (crc ^ (color >> 8)) * 16777619u;
+		}
+	}
+	return crc;
+}
+
+static bool loadBaseline(const char *filename) {
+	char line[128];
+	FILE *f = fopen(filename, "r");
+	if (!f) return false;
+	while (fgets(line, sizeof(line), f) && baseline_count < MAX_RESULTS) {
+		result_t *r = &baseline[baseline_count];
+		if (sscanf(line, "%31s %u %u %u %u %*u %x", r->name, &r->bytes, &r->windows, &r->writes, &r->cycles, &r->crc) == 6)
+			baseline_count++;
+	}
+	fclose(f);
+	return true;
+}
+
+// Start measuring on a cleared screen
+static void begin(void) {
+	ili9341_fillScreen(ILI9341_BLACK);
+	ili9341_setTextColor(ILI9341_WHITE, ILI9341_BLACK);
+	ili9341_setTextSize(1);
+	ili9341host_resetCost();
+}
+
+// Print result and compare with baseline
+static void end(const char *name) {
+	ili9341host_cost_t cost = ili9341host_cost;
+	uint32_t crc = screenCrc();
+	printf("%-28s %8u %7u %7u %9u %7u %08x", name, cost.bytes, cost.windows, cost.writes, cost.cycles,
+		cost.cycles / F_CPU_MHZ, crc);
+	for (uint8_t i = 0; i < baseline_count; i++) {
+		result_t *r = &baseline[i];
+		double change = 100.0 * ((double)cost.cycles - r->cycles) / r->cycles;
+		if (strcmp(r->name, name)) continue;
+		if (r->crc != crc) {
+			printf(" FAIL output changed");
+			failed = true;
+		} else if (change > THRESHOLD) {
+			printf(" FAIL %+.1f%%", change);
+			failed = true;
+		} else if (cost.cycles != r->cycles) {
+			printf(" %+.1f%%", change);
+		}
+	}
+	printf("\n");
+}
+
+// Draw every glyph of a font once, wrapping at the right edge of the screen
+static void drawFont(uint8_t f, uint8_t size, const char *name) {
+	uint8_t first = readFontByte(&fonts[f].font[FONT_FIRST_CHAR]);
+	uint8_t count = readFontByte(&fonts[f].font[FONT_CHAR_COUNT]);
+	uint16_t x = 0, y = 0;
+	begin();
+	ili9341_setFontIndex(fonts[f].font, fonts[f].index);
+	for (uint16_t c = first; c < first + count; c++) {
+		uint8_t w = (ili9341_charWidth(c) + 1) * size;
+		if (x + w > 320) {
+			x = 0;
+			y += ili9341_fontHeight() * size;
+		}
+		ili9341_drawChar(x, y, c, ILI9341_WHITE, ILI9341_BLACK, size);
+		x += w;
+	}
+	end(name);
+}
+
+int main(int argc, char *argv[]) {
+	char name[32];
+	uint16_t pixels[32*32];
+	if (argc > 1 && !loadBaseline(argv[1])) {
+		fprintf(stderr, "Cannot read %s\n", argv[1]);
+		return 2;
+	}
+	ili9341_init();
+	ili9341_setRotation(3);
+	printf("%-28s %8s %7s %7s %9s %7s %8s\n", "primitive", "bytes", "windows", "writes", "cycles", "us", "crc");
+	begin();
+	ili9341_fillScreen(ILI9341_NAVY);
+	end("fillScreen");
+	begin();
+	ili9341_fillrect(10, 10, 200, 100, ILI9341_RED);
+	end("fillrect");
+	begin();
+	for (uint16_t i = 0; i < 100; i++)
+		ili9341_drawpixel(i * 3, i * 2, ILI9341_WHITE);
+	end("drawpixel");
+	begin();
+	for (uint16_t y = 0; y < 240; y += 8)
+		ili9341_drawhline(0, y, 320, ILI9341_GREEN);
+	end("drawhline");
+	begin();
+	for (uint16_t x = 0; x < 320; x += 8)
+		ili9341_drawvline(x, 0, 240, ILI9341_GREEN);
+	end("drawvline");
+	begin();
+	for (uint16_t x = 0; x < 320; x += 32)
+		ili9341_drawLine(x, 0, 319 - x, 239, ILI9341_YELLOW);
+	end("drawLine");
+	begin();
+	for (int16_t a = 0; a < 360; a += 30)
+		ili9341_drawLineByAngle(160, 120, a, 100, ILI9341_YELLOW);
+	end("drawLineByAngle");
+	begin();
+	ili9341_drawRect(10, 10, 300, 220, ILI9341_WHITE);
+	end("drawRect");
+	begin();
+	ili9341_drawCircle(160, 120, 100, ILI9341_CYAN);
+	end("drawCircle");
+	begin();
+	ili9341_fillCircle(160, 120, 100, ILI9341_CYAN);
+	end("fillCircle");
+	begin();
+	for (uint16_t y = 10; y < 240; y += 18)
+		ili9341_fillCircle(6, y, 5, ILI9341_GREEN);
+	end("fillCircle_small");
+	begin();
+	for (uint16_t y = 10; y < 240; y += 18)
+		ili9341_fillCircleBg(6, y, 5, ILI9341_GREEN, ILI9341_BLACK);
+	end("fillCircleBg_small");
+	begin();
+	ili9341_drawEllipse(160, 120, 150, 80, ILI9341_MAGENTA);
+	end("drawEllipse");
+	begin();
+	ili9341_fillEllipse(160, 120, 150, 80, ILI9341_MAGENTA);
+	end("fillEllipse");
+	begin();
+	ili9341_drawTriangle(160, 10, 10, 230, 310, 200, ILI9341_ORANGE);
+	end("drawTriangle");
+	begin();
+	ili9341_fillTriangle(160, 10, 10, 230, 310, 200, ILI9341_ORANGE);
+	end("fillTriangle");
+	begin();
+	ili9341_fillArc(160, 120, 0, 60, 100, 100, 10, ILI9341_BLUE);
+	end("fillArc");
+	begin();
+	ili9341_fillArcDashed(160, 120, 0, 60, 100, 10, ILI9341_BLUE);
+	end("fillArcDashed");
+	begin();
+	ili9341_drawRoundRect(10, 10, 300, 220, 20, ILI9341_WHITE);
+	end("drawRoundRect");
+	begin();
+	ili9341_fillRoundRect(10, 10, 300, 220, 20, ILI9341_WHITE);
+	end("fillRoundRect");
+	begin();
+	ili9341_drawXBitmap(10, 10, xbm, 16, 16, ILI9341_WHITE, ILI9341_BLACK);
+	end("drawXBitmap");
+	begin();
+	ili9341_drawXBitmapTrans(10, 10, xbm, 16, 16, ILI9341_WHITE);
+	end("drawXBitmapTrans");
+	begin();
+	ili9341_drawRLEBitmap(10, 10, clear_icon, 64, 54, ILI9341_WHITE, ILI9341_BLACK);
+	ili9341_drawRLEBitmap(90, 10, tstorms_icon, 64, 54, ILI9341_WHITE, ILI9341_BLACK);
+	end("drawRLEBitmap");
+	begin();
+	for (uint16_t i = 0; i < 32*32; i++)
+		pixels[i] = i * 64;
+	ili9341_writeRect(10, 10, 32, 32, pixels);
+	end("writeRect");
+	begin();
+	ili9341_readRect(10, 10, 32, 32, pixels);
+	end("readRect");
+	for (uint8_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+		snprintf(name, sizeof(name), "drawChar_%s", fonts[f].name);
+		drawFont(f, 1, name);
+	}
+	// fonts of the main screen, which are also drawn at size 2
+	drawFont(LCDNUMS14X24, 2, "drawChar_lcdnums14x24_size2");
+	drawFont(ARIAL_BOLD_14, 2, "drawChar_Arial_bold_14_size2");
+	begin();
+	ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
+	for (uint16_t y = 0; y < 240; y += 16) {
+		ili9341_setCursor(0, y);
+		ili9341_puts("The quick brown fox jumps");
+	}
+	end("puts");
+	begin();
+	ili9341_setFontIndex(Arial_bold_14, Arial_bold_14_index);
+	for (uint16_t y = 0; y < 240; y += 16) {
+		ili9341_setCursor(0, y);
+		ili9341_putsClear("Latitude 52.1234", 319);
+	}
+	end("putsClear");
+	begin();
+	ili9341_setFont(lcdnums14x24);
+	ili9341_setTextSize(2);
+	ili9341_setCursor(0, 0);
+	ili9341_puts("12:34");
+	end("puts_size2");
+	return failed;
+}
@@ -0,0 +1,132 @@
+/*
+ * ILI9341 host backend
+ *
+ * Created: 16-10-2026 13:40:12
+ *
+ * Emulates the subset of ILI9341 commands used by the driver: column and
+ * page address set, memory write and read and memory access control.
+ */
+
+#include <stdio.h>
+#include "ili9341host.h"
+#include "../base_station/ili9341.h"
+
+#define MADCTL_MY 0x80
+#define MADCTL_MX 0x40
+#define MADCTL_MV 0x20
+
+uint8_t PORTD, DDRD, DDRB, SPCR, SPSR, SPDR;
+ili9341host_cost_t ili9341host_cost;
+
+// Display RAM in panel orientation
+static uint16_t gram[ILI9341_TFTHEIGHT][ILI9341_TFTWIDTH];
+static uint8_t command, madctl;
+static uint16_t count, data16, xs, xe, ys, ye, col, page;
+static bool selected;
+
+// Panel RAM location of column and page address
+static uint16_t *location(uint16_t c, uint16_t p) {
+	uint16_t x = (madctl & MADCTL_MV) ? p : c;
+	uint16_t y = (madctl & MADCTL_MV) ? c : p;
+	if (x >= ILI9341_TFTWIDTH || y >= ILI9341_TFTHEIGHT) return NULL;
+	if (madctl & MADCTL_MX) x = ILI9341_TFTWIDTH - 1 - x;
+	if (madctl & MADCTL_MY) y = ILI9341_TFTHEIGHT - 1 - y;
+	return &gram[y][x];
+}
+
+// Advance memory pointer within address window
+static void next(void) {
+	if (++col > xe) {
+		col = xs;
+		if (++page > ye) page = ys;
+	}
+}
+
+// Transfer one byte, returns the byte received from the display
+uint8_t ili9341host_spi(uint8_t data) {
+	uint8_t result = 0;
+	ili9341host_cost.bytes++;
+	ili9341host_cost.cycles += ILI9341HOST_CYCLES_PER_BYTE;
+	if (!selected) return 0;
+	if (!(PORTD & _BV(PD6))) {
+		// DC low selects command
+		ili9341host_cost.commands++;
+		command = data;
+		count = 0;
+		if (command == ILI9341_RAMWR || command == ILI9341_RAMRD) {
+			col = xs;
+			page = ys;
+		}
+		if (command == ILI9341_RAMWR) ili9341host_cost.windows++;
+		return 0;
+	}
+	data16 = (data16 << 8) | data;
+	switch (command) {
+		case ILI9341_CASET:
+			if (count == 1) xs = data16;
+			if (count == 3) xe = data16;
+			break;
+		case ILI9341_PASET:
+			if (count == 1) ys = data16;
+			if (count == 3) ye = data16;
+			break;
+		case ILI9341_MADCTL:
+			if (count == 0) madctl = data;
+			break;
+		case ILI9341_RAMWR:
+			if (count & 1) {
+				uint16_t *p = location(col, page);
+				if (p) *p = data16;
+				next();
+			}
+			break;
+		case ILI9341_RAMRD:
+			// dummy byte followed by 6 bit red, green and blue
+			if (count > 0) {
+				uint16_t *p = location(col, page);
+				uint16_t color = (p) ? *p : 0;
+				switch ((count - 1) % 3) {
+					case 0: result = (color >> 8) & 0xF8; break;
+					case 1: result = (color >> 3) & 0xFC; break;
+					case 2: result = color << 3; next(); break;
+				}
+			}
+			break;
+	}
+	count++;
+	return result;
+}
+
+// Chip select, false is active
+void ili9341host_select(bool cs) {
+	if (!cs && !selected) ili9341host_cost.selects++;
+	selected = !cs;
+}
+
+void ili9341host_resetCost(void) {
+	memset(&ili9341host_cost, 0, sizeof(ili9341host_cost));
+}
+
+// Read pixel at x, y of the current rotation
+uint16_t ili9341host_pixel(uint16_t x, uint16_t y) {
+	uint16_t *p = location(x, y);
+	return (p) ? *p : 0;
+}
+
+// Write display contents in the current rotation to binary PPM file
+bool ili9341host_dump(const char *filename) {
+	uint16_t width = (madctl & MADCTL_MV) ? ILI9341_TFTHEIGHT : ILI9341_TFTWIDTH;
+	uint16_t height = (madctl & MADCTL_MV) ? ILI9341_TFTWIDTH : ILI9341_TFTHEIGHT;
+	FILE *f = fopen(filename, "wb");
+	if (!f) return false;
+	fprintf(f, "P6\n%u %u\n255\n", width, height);
+	for (uint16_t y = 0; y < height; y++) {
+		for (uint16_t x = 0; x < width; x++) {
+			uint16_t color = ili9341host_pixel(x, y);
+			fputc(((color >> 8) & 0xF8) | (color >> 13), f);
+			fputc(((color >> 3) & 0xFC) | ((color >> 9) & 0x03), f);
+			fputc(((color << 3) & 0xF8) | ((color >> 2) & 0x07), f);
+		}
+	}
+	return fclose(f) == 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * ILI9341 host backend
+ *
+ * Created: 16-10-2026 13:40:12
+ *
+ * Stands in for the AVR SPI port when ili9341.c is built on a PC. The
+ * command and data stream is decoded into the display RAM, which can be
+ * read back per pixel or dumped to a PPM file. SPI traffic is counted to
+ * estimate the cost of drawing on the real hardware.
+ *
+ * gcc -O2 -I. -o prog prog.c ../base_station/ili9341.c ili9341host.c
+ */
+
+
+#ifndef ILI9341HOST_H_
+#define ILI9341HOST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// AVR definitions used by the driver
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define strchr_P strchr
+#define _BV(bit) (1 << (bit))
+#define _delay_ms(ms)
+#define loop_until_bit_is_set(sfr, bit)
+
+#define PB3 3
+#define PB5 5
+#define PD4 4
+#define PD6 6
+#define PD7 7
+#define SPE 6
+#define MSTR 4
+#define SPI2X 0
+
+extern uint8_t PORTD, DDRD, DDRB, SPCR, SPSR, SPDR;
+
+// Cycles per SPI byte of the FAST_SPI routines, Fck/2
+#define ILI9341HOST_CYCLES_PER_BYTE 18
+
+typedef struct {
+	uint32_t bytes;		// SPI bytes transferred
+	uint32_t commands;	// command bytes
+	uint32_t windows;	// memory write commands, one per address window
+	uint32_t writes;	// spiwrite16 calls, each pays the loop setup
+	uint32_t selects;	// CS toggles from high to low
+	uint32_t cycles;	// estimated AVR cycles spent on SPI transfers
+} ili9341host_cost_t;
+
+extern ili9341host_cost_t ili9341host_cost;
+
+uint8_t ili9341host_spi(uint8_t data);
+void ili9341host_select(bool cs);
+void ili9341host_resetCost(void);
+uint16_t ili9341host_pixel(uint16_t x, uint16_t y);
+bool ili9341host_dump(const char *filename);
+
+#endif /* ILI9341HOST_H_ */
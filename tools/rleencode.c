@@ -0,0 +1,156 @@
+/*
+ * RLE bitmap re-encoder
+ *
+ * Created: 16-10-2026 17:21:05
+ *
+ * Re-encodes the compressed monochrome bitmaps drawn by ili9341_drawRLEBitmap
+ * in a C source file. Every array named *_icon is decoded and encoded again
+ * with the fewest RLE and literal bytes, of which the sequence that is
+ * cheapest to decode is taken. The rest of the file is copied as is. Run on
+ * the host:
+ *
+ * gcc -O2 -o rleencode rleencode.c
+ * ./rleencode ../base_station/weatherIcons.h > weatherIcons.h && mv weatherIcons.h ../base_station
+ *
+ * Byte format: bit 7 set is a run of (bits 0-5) + 1 pixels with the value
+ * of bit 6, bit 7 clear is a literal of 7 pixels, LSB first.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PIXELS 16384
+#define MAX_RUN 64
+
+// Decode cost model of ili9341_drawRLEBitmap: every byte is read and
+// branched on, every pixel of a literal is pushed, a run is pushed once
+#define COST_BYTE 4
+#define COST_PUSH 1
+
+static uint8_t pixels[MAX_PIXELS];
+static uint32_t cost[MAX_PIXELS + 1];
+static uint8_t choice[MAX_PIXELS + 1]; // 0 is literal, else run length
+
+// Decode bytes, returns number of pixels
+static int decode(const uint8_t *data, int count) {
+	int n = 0;
+	for (int i = 0; i < count; i++) {
+		uint8_t byte = data[i];
+		if (byte & 0x80) {
+			for (int j = 0; j <= (byte & 0x3f) && n < MAX_PIXELS; j++)
+				pixels[n++] = (byte >> 6) & 1;
+		} else {
+			for (int j = 0; j < 7 && n < MAX_PIXELS; j++, byte >>= 1)
+				pixels[n++] = byte & 1;
+		}
+	}
+	return n;
+}
+
+// Cost of decoding bytes
+static uint32_t decodeCost(const uint8_t *data, int count) {
+	uint32_t total = 0;
+	for (int i = 0; i < count; i++)
+		total += COST_BYTE + ((data[i] & 0x80) ? COST_PUSH : 7 * COST_PUSH);
+	return total;
+}
+
+// Find cheapest encoding from the end backwards, returns number of bytes
+static int encode(int n, uint8_t *data) {
+	int count = 0;
+	cost[n] = 0;
+	for (int i = n - 1; i >= 0; i--) {
+		// cost is scaled to prefer fewer bytes, flash is worth more than decode time
+		cost[i] = UINT32_MAX;
+		if (i + 7 <= n) {
+			cost[i] = cost[i + 7] + 65536 + COST_BYTE + 7 * COST_PUSH;
+			choice[i] = 0;
+		}
+		for (int len = 1; len <= MAX_RUN && i + len <= n && pixels[i + len - 1] == pixels[i]; len++) {
+			uint32_t c = cost[i + len] + 65536 + COST_BYTE + COST_PUSH;
+			if (c < cost[i]) {
+				cost[i] = c;
+				choice[i] = len;
+			}
+		}
+	}
+	for (int i = 0; i < n; ) {
+		if (choice[i]) {
+			data[count++] = 0x80 | (pixels[i] << 6) | (choice[i] - 1);
+			i += choice[i];
+		} else {
+			uint8_t byte = 0;
+			for (int j = 6; j >= 0; j--)
+				byte = (byte << 1) | pixels[i + j];
+			data[count++] = byte;
+			i += 7;
+		}
+	}
+	return count;
+}
+
+static char *readFile(const char *filename) {
+	FILE *f = fopen(filename, "rb");
+	if (!f) return NULL;
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	char *text = malloc(size + 1);
+	if (text && fread(text, 1, size, f) == (size_t)size) {
+		text[size] = 0;
+	} else {
+		free(text);
+		text = NULL;
+	}
+	fclose(f);
+	return text;
+}
+
+int main(int argc, char *argv[]) {
+	static uint8_t old[MAX_PIXELS], new[MAX_PIXELS];
+	if (argc != 2) {
+		fprintf(stderr, "Usage: %s file\n", argv[0]);
+		return 2;
+	}
+	char *text = readFile(argv[1]);
+	if (!text) {
+		fprintf(stderr, "Cannot read %s\n", argv[1]);
+		return 2;
+	}
+	char *p = text, *start;
+	while ((start = strstr(p, "_icon[] PROGMEM = {"))) {
+		char *body = strchr(strchr(start, '{'), '\n') + 1, *end = strchr(body, '}'), *tail = body;
+		char *name = start;
+		// keep line ending of the array data, the lines around it are copied as is
+		const char *eol = (strchr(body, '\n')[-1] == '\r') ? "\r\n" : "\n";
+		int count = 0;
+		while (name > text && name[-1] != ' ') name--;
+		fwrite(p, 1, body - p, stdout);
+		for (char *s = body; s < end && count < MAX_PIXELS; ) {
+			char *next;
+			long value = strtol(s, &next, 16);
+			if (next == s) {
+				s++;
+				continue;
+			}
+			old[count++] = value;
+			s = tail = next;
+		}
+		int n = decode(old, count);
+		int size = encode(n, new);
+		for (int i = 0; i < size; i++) {
+			if (i % 12 == 0) printf("\t");
+			printf("0x%02x", new[i]);
+			if (i == size - 1) break;
+			printf((i % 12 == 11) ? ",%s" : ", ", eol);
+		}
+		fprintf(stderr, "%.*s: %d pixels, %d -> %d bytes, decode cost %u -> %u\n", (int)(start - name) + 5, name,
+			n, count, size, decodeCost(old, count), decodeCost(new, size));
+		p = tail;
+	}
+	fputs(p, stdout);
+	free(text);
+	return 0;
+}
@@ -0,0 +1,55 @@
+/*
+ * Time zone check
+ *
+ * Created: 17-10-2026 01:58:12
+ *
+ * Compares the UTC offset of every built in zone of the base station with
+ * the C library of the host, which is given the same TZ string, every
+ * minute of the given years. Prints the first differences and fails when
+ * there are any.
+ *
+ * gcc -O2 -o tzcheck tzcheck.c ../base_station/tz.c
+ * ./tzcheck [first year] [last year]
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../base_station/tz.h"
+
+#define MAX_REPORTS 3 // per zone
+
+int main(int argc, char *argv[]) {
+	int first = (argc > 1) ? atoi(argv[1]) : 2024;
+	int last = (argc > 2) ? atoi(argv[2]) : 2030;
+	struct tm begin = {.tm_year = first - 1900, .tm_mday = 1};
+	struct tm end = {.tm_year = last + 1 - 1900, .tm_mday = 1};
+	bool failed = false;
+
+	for (uint8_t i = 0; i < TZ_ZONES; i++) {
+		const char *zone = tz_zone(i);
+		tz_rule_t rule;
+		long count = 0, errors = 0;
+		if (!tz_parse(zone, &rule)) {
+			printf("%-44s parse error\n", zone);
+			failed = true;
+			continue;
+		}
+		tz_set(&rule);
+		setenv("TZ", zone, 1);
+		tzset();
+		for (time_t t = timegm(&begin); t < timegm(&end); t += 60, count++) {
+			struct tm tm;
+			localtime_r(&t, &tm);
+			long offset = rule.offset * 60L + tz_dst(&t, NULL);
+			if (offset != tm.tm_gmtoff) {
+				if (errors++ < MAX_REPORTS)
+					printf("%-44s %ld: offset %ld, expected %ld\n", zone, (long)t, offset, (long)tm.tm_gmtoff);
+				failed = true;
+			}
+		}
+		printf("%-44s %8ld minutes, %ld errors\n", zone, count, errors);
+	}
+	return failed;
+}
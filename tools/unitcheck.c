@@ -0,0 +1,67 @@
+/*
+ * Unit conversion check
+ *
+ * Created: 17-10-2026 00:21:44
+ *
+ * Compares the fixed point conversions of the base station with floating
+ * point over the range of the sensors and the pressure trend. Fails when a
+ * result is not rounded to the nearest last digit, except for values within
+ * 1% of halfway, which the precision of the factors cannot resolve.
+ *
+ * gcc -O2 -o unitcheck unitcheck.c ../base_station/units.c -lm
+ * ./unitcheck
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "../base_station/units.h"
+
+#define TOLERANCE 0.51 // last digits
+
+static const struct {
+	const char *name;
+	uint8_t unit;
+	double pa;		// Pa per last digit
+} pressures[] = {
+	{"hPa", PRESSURE_HPA, 10}, {"mmHg", PRESSURE_MMHG, 13.3322},
+	{"inHg", PRESSURE_INHG, 33.8639}, {"psi", PRESSURE_PSI, 68.9655}
+};
+
+static bool failed;
+
+static void report(const char *name, long count, double max_error, long worst) {
+	bool ok = max_error <= TOLERANCE;
+	printf("%-12s %8ld values, max error %.4f at %ld%s\n", name, count, max_error, worst, (ok) ? "" : " FAIL");
+	if (!ok) failed = true;
+}
+
+int main(void) {
+	for (uint8_t i = 0; i < sizeof(pressures) / sizeof(pressures[0]); i++) {
+		double max_error = 0;
+		long worst = 0, count = 0;
+		// trend in Pa/h and BME280 pressure range of 300 to 1100 hPa
+		for (int32_t pa = -20000; pa <= 110000; pa++, count++) {
+			double error = fabs(units_pressure(pa, pressures[i].unit) - pa / pressures[i].pa);
+			if (error > max_error) {
+				max_error = error;
+				worst = pa;
+			}
+		}
+		report(pressures[i].name, count, max_error, worst);
+	}
+	double max_error = 0;
+	long worst = 0, count = 0;
+	// BME280 range of -40 to 85 DegC and remote sensors up to 125 DegC, scaled by 10
+	for (int16_t temp = -400; temp <= 1250; temp++, count++) {
+		double error = fabs(units_temp(temp, DEG_FAHRENHEIT) - (temp * 1.8 + 320));
+		if (units_temp(temp, DEG_CELSIUS) != temp) error = INFINITY;
+		if (error > max_error) {
+			max_error = error;
+			worst = temp;
+		}
+	}
+	report("Fahrenheit", count, max_error, worst);
+	return failed;
+}